@@ -0,0 +1,109 @@
+// Controle adaptativo da perturbação: escolhe a ruína e a força de cada iteração.
+//
+// Cada braço é um par (ruína, fração de itens removidos). O controlador é um bandit
+// epsilon-guloso sobre a taxa recente de progresso por segundo de cada braço: médias
+// móveis exponenciais do ganho e do custo (tempo) das últimas vezes em que o braço foi
+// usado. Braços nunca usados são experimentados primeiro, e, se nenhum braço progrediu
+// recentemente (busca estagnada), a escolha é uniforme entre todos.
+//
+// Como o desperdício só depende do número de bins, o ganho de uma iteração considera
+// também a folga do bin mais vazio: com o mesmo número de bins, aumentar essa folga
+// aproxima a solução de fechar um bin.
+#ifndef ADAPTIVE_HPP
+#define ADAPTIVE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "perturbation.hpp"
+#include "solution.hpp"
+
+namespace bp {
+
+// Progresso de uma solução: (bins, folga do bin mais vazio)
+template <typename Size>
+std::pair<int, double> progress_of(const Solution<Size> &sol) {
+    double emptiest = sol.empty() ? 0.0 : (double)sol.by_slack().rbegin()->first;
+    return {(int)sol.size(), emptiest};
+}
+
+// Ganho de "before" para "after": bins fechados, ou, com o mesmo número de bins, o
+// aumento da folga do bin mais vazio como fração da capacidade
+inline double progress_gain(const std::pair<int, double> &before, const std::pair<int, double> &after,
+                            double capacity) {
+    if (after.first != before.first) return std::max(0, before.first - after.first);
+    return std::max(0.0, (after.second - before.second) / capacity);
+}
+
+struct Arm {
+    RuinKind ruin;
+    double ratio;        // Fração dos itens removidos
+    double gain = 0.0;   // Média móvel do ganho por iteração
+    double cost = 0.0;   // Média móvel do tempo por iteração (segundos)
+    int pulls = 0;
+
+    double score() const { return cost > 0 ? gain / cost : 0.0; }
+};
+
+class AdaptivePerturbation {
+public:
+    static constexpr double EPSILON = 0.1; // Probabilidade de explorar um braço aleatório
+    static constexpr double DECAY = 0.1;   // Peso da última observação nas médias móveis
+
+    // "base_ratio": fração central; as forças testadas são 1/4, 1/2, 1 e 2 vezes ela.
+    // Com "adapt_ruin" falso, todos os braços usam "ruin".
+    AdaptivePerturbation(int items, double base_ratio, bool adapt_ruin, RuinKind ruin) : items(items) {
+        const double factors[] = {0.25, 0.5, 1.0, 2.0};
+        const RuinKind kinds[] = {RuinKind::RandomItems, RuinKind::EmptiestBins, RuinKind::RelatedItems};
+        for (RuinKind kind : kinds) {
+            if (!adapt_ruin && kind != ruin) continue;
+            for (double f : factors) arms.push_back({kind, base_ratio * f});
+        }
+    }
+
+    template <typename Rng>
+    int choose(Rng &rng) {
+        for (size_t a = 0; a < arms.size(); ++a) {
+            if (arms[a].pulls == 0) return a;
+        }
+        int best = leader();
+        if (arms[best].score() <= 0 || std::uniform_real_distribution<double>(0.0, 1.0)(rng) < EPSILON) {
+            return std::uniform_int_distribution<int>(0, arms.size() - 1)(rng);
+        }
+        return best;
+    }
+
+    void update(int a, double gain, double seconds) {
+        Arm &arm = arms[a];
+        if (arm.pulls++ == 0) {
+            arm.gain = gain;
+            arm.cost = seconds;
+        }
+        else {
+            arm.gain += DECAY * (gain - arm.gain);
+            arm.cost += DECAY * (seconds - arm.cost);
+        }
+    }
+
+    // Braço de maior taxa recente (o escolhido quando não há exploração nem estagnação)
+    int leader() const {
+        int best = 0;
+        for (size_t a = 1; a < arms.size(); ++a) {
+            if (arms[a].score() > arms[best].score()) best = a;
+        }
+        return best;
+    }
+
+    int strength(int a) const { return std::max(1, (int)std::lround(items * arms[a].ratio)); }
+    const Arm &arm(int a) const { return arms[a]; }
+
+private:
+    int items;
+    std::vector<Arm> arms;
+};
+
+}  // namespace bp
+
+#endif
@@ -0,0 +1,253 @@
+/*
+ * Micro-benchmark dos kernels do Bin Packing.
+ *
+ * Mede isoladamente, para cada combinação de n, capacidade e distribuição de tamanhos:
+ * - best_fit:      construção Best Fit Decreasing a partir das classes;
+ * - fitness:       avaliação de uma solução;
+ * - perturb:       uma aplicação do ruin-and-recreate (itens aleatórios, ordem aleatória);
+ * - local_search:  uma passada da busca local até o ótimo local, partindo da solução perturbada.
+ *
+ * Para cada kernel informa ns/op, alocações/op (contadas substituindo o operator new global)
+ * e cache-misses/op pelo perf_event do Linux quando disponível ("n/d" caso contrário).
+ * Apenas a operação medida entra na contagem; a preparação de cada repetição (cópia da
+ * solução, perturbação antes da busca local) fica fora.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "bin_packing.hpp"
+
+using namespace std;
+
+// Contagem de alocações: todo operator new do processo passa por aqui.
+// As funções não são expandidas inline para que o par new/malloc e delete/free não seja
+// visto pelo compilador como alocação e liberação incompatíveis.
+static atomic<long long> allocations{0};
+
+__attribute__((noinline)) void *operator new(size_t size) {
+    allocations.fetch_add(1, memory_order_relaxed);
+    if (void *p = malloc(size ? size : 1)) return p;
+    throw bad_alloc();
+}
+__attribute__((noinline)) void operator delete(void *p) noexcept { free(p); }
+__attribute__((noinline)) void operator delete(void *p, size_t) noexcept { free(p); }
+
+// Contador de cache-misses do hardware (perf_event); inválido se o kernel não permitir
+class CacheMissCounter {
+public:
+    CacheMissCounter() {
+#ifdef __linux__
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    }
+    ~CacheMissCounter() {
+#ifdef __linux__
+        if (fd >= 0) close(fd);
+#endif
+    }
+
+    bool available() const { return fd >= 0; }
+
+    void start() {
+#ifdef __linux__
+        if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+    void stop() {
+#ifdef __linux__
+        if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+    }
+    long long read_total() const {
+        long long value = 0;
+#ifdef __linux__
+        if (fd >= 0 && ::read(fd, &value, sizeof(value)) != sizeof(value)) value = 0;
+#endif
+        return value;
+    }
+
+private:
+    int fd = -1;
+};
+
+struct BenchConfig {
+    vector<int> sizes = {1000, 10000, 100000};
+    vector<int> capacities = {150, 1000, 10000};
+    vector<string> distributions = {"uniform", "small", "large"};
+    double min_time = 0.2; // Segundos medidos por kernel
+    unsigned seed = 1;
+};
+
+// uniform: [C/10, C/2]; small: [1, C/10]; large: [C/3, 2C/3] (poucos itens por bin)
+bp::Instance<int> generate(int n, int capacity, const string &dist, mt19937 &rng) {
+    int lo = max(1, capacity / 10), hi = max(1, capacity / 2);
+    if (dist == "small") lo = 1, hi = max(1, capacity / 10);
+    else if (dist == "large") lo = max(1, capacity / 3), hi = max(1, 2 * capacity / 3);
+    uniform_int_distribution<int> size(lo, hi);
+
+    bp::Instance<int> inst;
+    inst.capacity = capacity;
+    inst.n = n;
+    inst.items.resize(n);
+    for (auto &item : inst.items) item = size(rng);
+    return inst;
+}
+
+struct Measure {
+    double ns_per_op;
+    double allocs_per_op;
+    double misses_per_op; // < 0: indisponível
+};
+
+// Repete "setup" (não medido) e "op" (medido) até acumular "min_time" segundos de "op"
+Measure measure(double min_time, CacheMissCounter &perf, const function<void()> &setup, const function<void()> &op) {
+    using Clock = chrono::steady_clock;
+    Clock::duration elapsed{0};
+    long long ops = 0, allocs = 0, misses = 0;
+    while (chrono::duration<double>(elapsed).count() < min_time || ops < 3) {
+        setup();
+        long long before_misses = perf.read_total();
+        long long before_allocs = allocations.load(memory_order_relaxed);
+        perf.start();
+        auto t0 = Clock::now();
+        op();
+        elapsed += Clock::now() - t0;
+        perf.stop();
+        allocs += allocations.load(memory_order_relaxed) - before_allocs;
+        misses += perf.read_total() - before_misses;
+        ops++;
+    }
+    double seconds = chrono::duration<double>(elapsed).count();
+    return {seconds * 1e9 / ops, (double)allocs / ops, perf.available() ? (double)misses / ops : -1.0};
+}
+
+void print_row(const char *kernel, const string &dist, int n, int capacity, const Measure &m) {
+    char misses[32];
+    if (m.misses_per_op < 0) snprintf(misses, sizeof(misses), "n/d");
+    else snprintf(misses, sizeof(misses), "%.1f", m.misses_per_op);
+    printf("%-13s %-8s %8d %7d %14.1f %12.1f %14s\n", kernel, dist.c_str(), n, capacity, m.ns_per_op,
+           m.allocs_per_op, misses);
+    fflush(stdout);
+}
+
+void run(const BenchConfig &config) {
+    CacheMissCounter perf;
+    mt19937 rng(config.seed);
+    volatile double sink = 0;
+
+    printf("%-13s %-8s %8s %7s %14s %12s %14s\n", "kernel", "dist", "n", "C", "ns/op", "allocs/op",
+           "cache-miss/op");
+    for (const auto &dist : config.distributions) {
+        for (int capacity : config.capacities) {
+            for (int n : config.sizes) {
+                bp::Instance<int> inst = generate(n, capacity, dist, rng);
+                bp::Classes<int> classes = bp::compress_items(inst.items);
+                bp::Solution<int> base = bp::best_fit(classes, capacity);
+                bp::RuinRecreate<int> ruin(classes);
+                bp::SingleClassRelocation neighborhood;
+                int p = max(1, (int)(n * 0.05));
+                bp::Solution<int> work;
+
+                auto nothing = [] {};
+                print_row("best_fit", dist, n, capacity, measure(config.min_time, perf, nothing, [&] {
+                    work = bp::best_fit(classes, capacity);
+                }));
+                print_row("fitness", dist, n, capacity, measure(config.min_time, perf, nothing, [&] {
+                    sink = sink + bp::fitness(base, capacity).second;
+                }));
+                print_row("perturb", dist, n, capacity, measure(config.min_time, perf, [&] { work = base; }, [&] {
+                    ruin.apply(work, classes, rng, p, bp::RuinKind::RandomItems, bp::RecreateOrder::Random);
+                }));
+                auto perturbed = [&] {
+                    work = base;
+                    ruin.apply(work, classes, rng, p, bp::RuinKind::RandomItems, bp::RecreateOrder::Random);
+                };
+                print_row("local_search", dist, n, capacity, measure(config.min_time, perf, perturbed, [&] {
+                    while (neighborhood.improve(work, classes, capacity)) {
+                    }
+                }));
+            }
+        }
+    }
+    if (!perf.available()) {
+        fprintf(stderr, "Aviso: perf_event indisponivel (permissao ou kernel); cache-misses nao medidos.\n");
+    }
+}
+
+vector<string> split(const string &text) {
+    vector<string> parts;
+    stringstream ss(text);
+    string part;
+    while (getline(ss, part, ',')) {
+        if (!part.empty()) parts.push_back(part);
+    }
+    return parts;
+}
+
+vector<int> split_ints(const string &text) {
+    vector<int> values;
+    for (const auto &part : split(text)) values.push_back(stoi(part));
+    return values;
+}
+
+void print_usage(const char *prog) {
+    cerr << "Uso: " << prog << " [-n <lista>] [-cap <lista>] [-dist <lista>] [-time <segundos>] [-seed <semente>]\n";
+    cerr << "  -n <lista>      : Numeros de itens, separados por virgula (padrao 1000,10000,100000).\n";
+    cerr << "  -cap <lista>    : Capacidades (padrao 150,1000,10000).\n";
+    cerr << "  -dist <lista>   : uniform, small e/ou large (padrao todas).\n";
+    cerr << "  -time <segundos>: Tempo medido por kernel (padrao 0.2).\n";
+    cerr << "  -seed <semente> : Semente do gerador de instancias (padrao 1).\n";
+}
+
+int main(int argc, char **argv) {
+    BenchConfig config;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            config.sizes = split_ints(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-cap") == 0 && i + 1 < argc) {
+            config.capacities = split_ints(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-dist") == 0 && i + 1 < argc) {
+            config.distributions = split(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-time") == 0 && i + 1 < argc) {
+            config.min_time = stod(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-seed") == 0 && i + 1 < argc) {
+            config.seed = stoul(argv[++i]);
+        }
+        else {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    run(config);
+    return EXIT_SUCCESS;
+}
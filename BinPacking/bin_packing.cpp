@@ -1,264 +1,243 @@
 /*
- * Implementação de uma Meta-heurística de Solução Única para o Bin Packing.
- * (Iterated Local Search - ILS)
- * 
- * 1. Representação da Solução:
- * - Uma solução é representada por "Solution", que é um "vector<Bin>".
- * - Cada "Bin" (um "vector<Item>") contém os itens (seus tamanhos "double") alocados naquele recipiente.
+ * Front end de linha de comando do Bin Packing (ILS).
  *
- * 2. Função de Avaliação:
- * - A função "fitness(Solution, capacity)" calcula a qualidade de uma solução.
- * - Retorna um "pair<int, double>":
- * - first: O número de bins utilizados - objetivo primário a minimizar.
- * - second: O desperdício total (soma das capacidades não utilizadas em cada bin) - objetivo secundário a minimizar.
- * - Comparações entre "Fit" priorizam o número de bins, depois o desperdício.
- *
- * 3. Geração da Solução Inicial:
- * - A heurística Best Fit é usada.
- * - Cada item é inserido no bin onde ele melhor se encaixa (deixando o menor espaço residual),
- *   dentre os bins onde ele cabe. Se não couber em nenhum, um novo bin é criado.
- *
- * 4. Estratégia de Busca Local:
- * - A função "local_search" implementa a busca local.
- * - Vizinhança Explorada: Foca em bins que contêm *apenas um item*. Tenta mover este item
- * para outro bin existente onde ele caiba, escolhendo o bin destino que resulta no menor
- * espaço residual após a inserção (estratégia 'best fit' para a movimentação).
- * - Tipo de Busca: É uma forma de Best Improvement dentro da vizinhança. A busca
- * para assim que uma melhoria é encontrada. O processo se repete até que nenhuma melhoria 
- * desse tipo seja possível ou o tempo limite se esgote.
- *
- * 5. Perturbação:
- * - A função "perturb" modifica a solução atual para escapar de ótimos locais.
- * - Estratégia: Remove "p" itens aleatoriamente de seus bins atuais.
- * - Os itens removidos são então reinseridos na solução usando a heurística Best Fit.
- *
- * 6. Critério de Parada:
- * - O algoritmo executa iterações de perturbação e busca local até que um tempo limite
- * global ("time_limit"), fornecido como argumento de linha de comando, seja atingido.
+ * - O algoritmo, a representação e as políticas estão na biblioteca header-only
+ *   descrita em bin_packing.hpp; aqui ficam apenas a leitura dos argumentos, a escolha
+ *   das políticas e a saída.
+ * - Se todos os tamanhos são inteiros, o solver é instanciado com itens "int"
+ *   (aritmética exata); caso contrário, com "double".
+ * - As instâncias são lidas por uma thread de leitura (input.hpp) e entregues por uma fila
+ *   limitada: a leitura da instância seguinte se sobrepõe à busca da atual, e cada
+ *   instância é liberada assim que o seu resultado é emitido.
+ * - A solução inicial vem de um portfólio de heurísticas construtivas executadas em
+ *   paralelo ("-init" escolhe o subconjunto); ao final, um resumo mostra quantas vezes
+ *   cada heurística atingiu o melhor número de bins e o tempo total gasto em cada uma.
+ * - Por padrão a força da perturbação e a ruína são escolhidas a cada iteração pelo
+ *   controle adaptativo (adaptive.hpp); as trocas de decisão aparecem no log "debug".
+ * - "-decompose k" ativa o modo de decomposição (decomposition.hpp) para instâncias muito
+ *   grandes: partes estratificadas resolvidas em paralelo e reparo dos bins menos cheios.
+ * - A busca não escreve diretamente na saída: os eventos (solução inicial, melhorias e
+ *   resultado final) são enviados ao "ResultWriter" (output.hpp), que formata e escreve
+ *   em uma thread de fundo, com níveis de log e arquivos de resultado JSON/CSV opcionais.
  *
  */
 
  #include <iostream>
  #include <vector>
- #include <numeric>
- #include <algorithm>
  #include <chrono>
- #include <random>
  #include <string>
- #include <iomanip>
  #include <utility>
  #include <cstring>
- #include <limits>
- 
- using namespace std;
- 
- using Item = double;
- using Bin = vector<Item>;
- using Solution = vector<Bin>;
- using Fit = pair<int, double>;
- 
- struct Instance {
-     double capacity;
-     int n;
-     vector<Item> items;
- };
- 
- Fit fitness(const Solution &bins, double capacity) {
-     if (bins.empty()) {
-         return {0, 0};
-     }
- 
-     int num_bins = bins.size();
-     double total_waste = 0.0;
-     for (const auto &b : bins) {
-         double sum = accumulate(b.begin(), b.end(), 0.0);
-         total_waste += (capacity - sum);
-     }
- 
-     return {num_bins, total_waste};
- }
+ #include <climits>
+ #include <iomanip>
+ #include <sstream>
+ #include <thread>
  
- Solution best_fit(const vector<Item> &items, double capacity) {
-     Solution bins;
-     vector<double> bin_sums;
+ #include "bin_packing.hpp"
+ #include "input.hpp"
+ #include "output.hpp"
  
-     for (auto item : items) {
-         int best_idx = -1;
-         double min_remain = capacity + 1.0;
+ using namespace std;
  
-         for (size_t i = 0; i < bins.size(); ++i) {
-             if (bin_sums[i] + item <= capacity) {
-                 double remain = capacity - (bin_sums[i] + item);
-                 if (remain < min_remain) {
-                     min_remain = remain;
-                     best_idx = i;
-                 }
-             }
-         }
+ // Desempenho acumulado do portfólio construtivo ao longo das instâncias
+ struct PortfolioStats {
+     int runs[bp::NUM_HEURISTICS] = {};
+     int wins[bp::NUM_HEURISTICS] = {}; // Atingiu o menor número de bins (empates contam para todas)
+     double time[bp::NUM_HEURISTICS] = {};
  
-         if (best_idx != -1) {
-             bins[best_idx].push_back(item);
-             bin_sums[best_idx] += item;
+     void add(const vector<bp::ConstructionRun> &construction) {
+         int best = INT_MAX;
+         for (const auto &run : construction) {
+             if (run.bins >= 0) best = min(best, run.bins);
          }
-         else {
-             bins.emplace_back(Bin{item});
-             bin_sums.push_back(item);
+         for (const auto &run : construction) {
+             runs[run.heuristic]++;
+             time[run.heuristic] += run.time;
+             if (run.bins == best) wins[run.heuristic]++;
          }
      }
-     return bins;
- }
- 
- Solution local_search(Solution current, double capacity, double time_limit) {
-     auto start = chrono::steady_clock::now();
-     auto end = start + chrono::duration<double>(time_limit);
- 
-     bool improved;
-     do {
-         if (chrono::steady_clock::now() >= end) break;
- 
-         improved = false;
-         int best_src_bin = -1;
-         int best_item_idx = -1;
-         int best_dest_bin = -1;
  
-         for (size_t i = 0; i < current.size(); ++i) {
-             if (current[i].size() == 1) {
-                 Item item = current[i][0];
+     bool any() const { return any_of(begin(runs), end(runs), [](int r) { return r > 0; }); }
  
-                 int current_best_j = -1;
-                 double min_remain_in_j = capacity + 1.0;
- 
-                 for (size_t j = 0; j < current.size(); ++j) {
-                     if (i == j) continue;
- 
-                     double sum_j = accumulate(current[j].begin(), current[j].end(), 0.0);
-                     if (sum_j + item <= capacity) {
-                         double remain = capacity - (sum_j + item);
-                         if (remain < min_remain_in_j) {
-                             min_remain_in_j = remain;
-                             current_best_j = j;
-                         }
-                     }
-                 }
+     string summary() const {
+         ostringstream out;
+         out << fixed << setprecision(3) << "Portfolio construtivo (vitorias/execucoes, tempo total):";
+         for (int h = 0; h < bp::NUM_HEURISTICS; ++h) {
+             if (runs[h] == 0) continue;
+             out << "\n   -> " << bp::heuristic_name(h) << ": " << wins[h] << "/" << runs[h] << ", " << time[h] << "s";
+         }
+         return out.str();
+     }
+ };
  
-                 if (current_best_j != -1) {
-                     best_src_bin = i;
-                     best_item_idx = 0;
-                     best_dest_bin = current_best_j;
-                     improved = true;
-                     break;
-                 }
+ // Repassa os eventos do solver para o ResultWriter
+ struct WriterListener {
+     ResultWriter &writer;
+     int instance;
+ 
+     template <typename Result>
+     void on_start(const Result &res) {
+         writer.start(instance, res.initial_fit.first, res.initial_fit.second);
+         if (writer.enabled(LogLevel::Info) && res.fixed_bins + res.remaining_items > 0) {
+             const char *names[bp::NUM_RULES] = {"R1 isolados", "R2 pares exatos", "R3 pares dominantes"};
+             string text = "   -> Reducao:";
+             for (int r = 0; r < bp::NUM_RULES; ++r) {
+                 text += string(r ? "," : "") + " " + names[r] + "=" + to_string(res.reduction.items_removed[r]) +
+                         " itens/" + to_string(res.reduction.bins_fixed[r]) + " bins";
              }
+             text += " (restantes: " + to_string(res.remaining_items) + " itens)";
+             writer.message(LogLevel::Info, move(text));
          }
- 
-         if (improved) {
-             Item item = current[best_src_bin][best_item_idx];
-             current[best_dest_bin].push_back(item);
-             current.erase(current.begin() + best_src_bin);
-         } else {
-             break;
+         writer.message(LogLevel::Debug, "   -> Classes distintas: " + to_string(res.num_classes) +
+                                         " (de " + to_string(res.remaining_items) + " itens)");
+         if (writer.enabled(LogLevel::Debug) && !res.construction.empty()) {
+             ostringstream text;
+             text << fixed << setprecision(4) << "   -> Portfolio:";
+             for (const auto &run : res.construction) {
+                 text << " " << bp::heuristic_name(run.heuristic) << "=";
+                 if (run.bins < 0) text << "interrompida";
+                 else text << run.bins;
+                 text << " (" << run.time << "s)";
+             }
+             text << " -> " << bp::heuristic_name(res.initial_heuristic);
+             writer.message(LogLevel::Debug, text.str());
          }
+     }
  
-     } while (chrono::steady_clock::now() < end);
+     void on_improvement(int iterations, const bp::Fit &fit, double time) {
+         writer.improvement(instance, iterations, fit.first, time);
+     }
  
-     current.erase(remove_if(current.begin(), current.end(), [](const Bin &b) { return b.empty(); }), current.end());
+     void on_control(int iterations, const bp::Arm &arm, int strength, double time) {
+         if (!writer.enabled(LogLevel::Debug)) return;
+         const char *names[] = {"random", "bins", "related"};
+         ostringstream text;
+         text << fixed << setprecision(3) << "   -> Controle (Iter: " << iterations << ", " << time
+              << "s): ruina=" << names[(int)arm.ruin] << ", p=" << strength << ", taxa=" << arm.score() << "/s";
+         writer.message(LogLevel::Debug, text.str());
+     }
+
+     template <typename Plain>
+     void on_solution(const Plain &) {}
+ };
  
-     return current;
- }
+ enum class AcceptanceKind { All, NotWorse };
  
+ // Opcoes de execucao escolhidas na linha de comando
+ struct RunOptions {
+     AcceptanceKind accept = AcceptanceKind::All;
+     bp::SolverConfig solver;
+     bp::DecompositionConfig decomposition;
+     bool compare = false; // Com decomposicao: resolve tambem a instancia inteira, no mesmo tempo
+ };
  
- Solution perturb(Solution pert, double capacity, mt19937 &rng, int p) {
-     vector<Item> removed_items;
+ // Vazao e qualidade do modo de decomposicao
+ void report_decomposition(ResultWriter &writer, const bp::DecompositionStats &st, int items, int bins, double time) {
+     if (!writer.enabled(LogLevel::Info)) return;
+     ostringstream text;
+     text << fixed << setprecision(2) << "   -> Decomposicao: " << st.parts << " partes em " << st.part_time
+          << "s, bins apos juncao=" << st.merged_bins << ", reparo=" << st.repair_in << "->" << st.repair_out << " bins\n";
+     text << "   -> Vazao: " << (time > 0 ? items / time : 0.0) << " itens/s, " << (time > 0 ? st.iterations / time : 0.0)
+          << " iter/s; gap para L1=" << bins - st.lower_bound << " bins ("
+          << 100.0 * (bins - st.lower_bound) / max(1, st.lower_bound) << "%)";
+     writer.message(LogLevel::Info, text.str());
+ }
  
-     vector<pair<size_t, size_t>> item_coords;
-     for (size_t i = 0; i < pert.size(); ++i) {
-         for (size_t j = 0; j < pert[i].size(); ++j) {
-             item_coords.push_back({i, j});
+ template <typename Size, typename Acceptance>
+ void solve_instance(bp::Instance<Size> inst, const RunOptions &opts, bp::Clock::time_point deadline,
+                     ResultWriter &writer, PortfolioStats &stats, int inst_counter) {
+     double capacity = inst.capacity;
+     WriterListener listener{writer, inst_counter};
+     bp::SolverResult<Size> res;
+     if (opts.decomposition.parts > 0) {
+         bp::DecompositionStats dstats;
+         res = bp::solve_decomposed<Size, bp::SingleClassRelocation, Acceptance>(inst, opts.solver, opts.decomposition,
+                                                                                 deadline, dstats, listener);
+         report_decomposition(writer, dstats, inst.n, res.best_fit.first, res.time);
+         if (opts.compare) {
+             // Solver monolitico com o mesmo tempo de parede gasto pela decomposicao
+             bp::Solver<Size, bp::SingleClassRelocation, Acceptance> mono(move(inst), opts.solver);
+             auto mono_end = bp::Clock::now() + chrono::duration_cast<bp::Clock::duration>(chrono::duration<double>(res.time));
+             bp::SolverResult<Size> mono_res = mono.solve(mono_end);
+             int diff = res.best_fit.first - mono_res.best_fit.first;
+             writer.message(LogLevel::Info, "   -> Monolitico (mesmo tempo): Bins=" + to_string(mono_res.best_fit.first) +
+                                            ", decomposicao - monolitico = " + (diff > 0 ? "+" : "") + to_string(diff) + " bins");
          }
      }
- 
-     if (item_coords.empty()) return pert;
- 
-     shuffle(item_coords.begin(), item_coords.end(), rng);
-     int num_to_remove = min((int)item_coords.size(), p);
- 
-     vector<pair<size_t, size_t>> coords_to_remove;
-     for (int k = 0; k < num_to_remove; ++k) {
-         coords_to_remove.push_back(item_coords[k]);
+     else {
+         bp::Solver<Size, bp::SingleClassRelocation, Acceptance> solver(move(inst), opts.solver);
+         res = solver.solve(deadline, listener);
      }
-     sort(coords_to_remove.begin(), coords_to_remove.end(), [](const auto& a, const auto& b){
-         if (a.first != b.first) return a.first > b.first;
-         return a.second > b.second;
-     });
  
-     for(const auto& coord : coords_to_remove) {
-         size_t bin_idx = coord.first;
-         size_t item_idx = coord.second;
-         if (bin_idx < pert.size() && item_idx < pert[bin_idx].size()) {
-              removed_items.push_back(pert[bin_idx][item_idx]);
-              pert[bin_idx].erase(pert[bin_idx].begin() + item_idx);
-         }
+     OutputEvent result;
+     result.instance = inst_counter;
+     result.time = res.time;
+     result.iterations = res.iterations;
+     result.bins = res.best_fit.first;
+     result.waste = res.best_fit.second;
+     result.capacity = capacity;
+     result.initial_bins = res.initial_fit.first;
+     result.initial_waste = res.initial_fit.second;
+     result.fixed_bins = res.fixed_bins;
+     result.initial_heuristic = bp::heuristic_name(res.initial_heuristic);
+     stats.add(res.construction);
+     result.solution.reserve(res.solution.size());
+     for (const auto &bin : res.solution) {
+         result.solution.emplace_back(bin.begin(), bin.end());
      }
+     writer.result(move(result));
+ }
  
- 
-     pert.erase(remove_if(pert.begin(), pert.end(), [](const Bin &b) { return b.empty(); }), pert.end());
- 
-     vector<double> bin_sums;
-     for(const auto& bin : pert) {
-         bin_sums.push_back(accumulate(bin.begin(), bin.end(), 0.0));
+ // Escolhe o tipo de item e o critério de aceitação em tempo de execução; cada combinação
+ // é uma instanciação própria do Solver
+ void dispatch(bp::Instance<double> inst, const RunOptions &opts, bp::Clock::time_point deadline, ResultWriter &writer,
+               PortfolioStats &stats, int inst_counter) {
+     if (bp::is_integral_instance(inst)) {
+         auto int_inst = bp::convert_instance<int>(inst);
+         if (opts.accept == AcceptanceKind::All) solve_instance<int, bp::AcceptAll>(move(int_inst), opts, deadline, writer, stats, inst_counter);
+         else solve_instance<int, bp::AcceptNotWorse>(move(int_inst), opts, deadline, writer, stats, inst_counter);
      }
- 
-     shuffle(removed_items.begin(), removed_items.end(), rng);
- 
-     for (auto item : removed_items) {
-         int best_idx = -1;
-         double min_remain = capacity + 1.0;
- 
-         for (size_t i = 0; i < pert.size(); ++i) {
-             if (bin_sums[i] + item <= capacity) {
-                 double remain = capacity - (bin_sums[i] + item);
-                 if (remain < min_remain) {
-                     min_remain = remain;
-                     best_idx = i;
-                 }
-             }
-         }
- 
-         if (best_idx != -1) {
-             pert[best_idx].push_back(item);
-             bin_sums[best_idx] += item;
-         } else {
-             pert.emplace_back(Bin{item});
-             bin_sums.push_back(item);
-         }
+     else {
+         if (opts.accept == AcceptanceKind::All) solve_instance<double, bp::AcceptAll>(move(inst), opts, deadline, writer, stats, inst_counter);
+         else solve_instance<double, bp::AcceptNotWorse>(move(inst), opts, deadline, writer, stats, inst_counter);
      }
- 
-     return pert;
  }
  
- // Leitura dos parametros
- vector<Instance> read_instances(istream &in) {
-     int P;
-     in >> P;
-     vector<Instance> instances;
-     instances.reserve(P);
-     for (int p = 0; p < P; ++p) {
-         Instance inst;
-         in >> inst.capacity >> inst.n;
-         inst.items.resize(inst.n);
-         for (int i = 0; i < inst.n; ++i) {
-             in >> inst.items[i];
-         }
-         instances.push_back(move(inst));
+ // Lista separada por virgulas de heuristicas construtivas (ex.: "ffd,bfd,mbs") -> mascara
+ bool parse_heuristics(const string &list, unsigned &mask) {
+     static const char *names[bp::NUM_HEURISTICS] = {"ff", "bf", "ffd", "bfd", "mbs", "ss"};
+     mask = 0;
+     stringstream in(list);
+     string name;
+     while (getline(in, name, ',')) {
+         int h = find_if(begin(names), end(names), [&](const char *n) { return name == n; }) - begin(names);
+         if (h == bp::NUM_HEURISTICS) return false;
+         mask |= 1u << h;
      }
-     return instances;
+     return mask != 0;
  }
  
  // Help dos parametros
  void print_usage(const char *prog) {
-     cerr << "Uso: " << prog << " -time <segundos> [-s] < <arquivo_entrada>\n";
+     cerr << "Uso: " << prog << " -time <segundos> [-s] [-log <nivel>] [-json <arquivo>] [-csv <arquivo>] < <arquivo_entrada>\n";
      cerr << "  -time <segundos>: Tempo limite total em segundos (obrigatorio, > 0).\n";
      cerr << "  -s              : Mostrar a composicao dos bins na saida (opcional).\n";
+     cerr << "  -log <nivel>    : quiet, info (padrao) ou debug.\n";
+     cerr << "  -json <arquivo> : Grava os resultados (com a composicao dos bins) em JSON.\n";
+     cerr << "  -csv <arquivo>  : Grava um resumo por instancia em CSV.\n";
+     cerr << "  -noreduce       : Desativa o pre-processamento de reducao (opcional).\n";
+     cerr << "  -accept <crit.> : all (padrao, aceita sempre) ou notworse.\n";
+     cerr << "  -ruin <tipo>    : random, bins (mais vazios) ou related (tamanhos parecidos);\n";
+     cerr << "                    sem esta opcao, a ruina e escolhida pelo controle adaptativo.\n";
+     cerr << "  -noadapt        : Forca e ruina fixas (5% dos itens, ruina random ou -ruin).\n";
+     cerr << "  -recreate <ord.>: random (padrao) ou decreasing (tamanho decrescente).\n";
+     cerr << "  -init <lista>   : Heuristicas construtivas do portfolio, separadas por virgula:\n";
+     cerr << "                    ff, bf, ffd, bfd, mbs, ss (padrao: todas).\n";
+     cerr << "  -seqinit        : Executa o portfolio sequencialmente (sem threads).\n";
+     cerr << "  -decompose <k>  : Divide cada instancia em k partes resolvidas em paralelo, seguidas de um\n";
+     cerr << "                    reparo dos bins menos cheios (k <= 0: uma parte por nucleo).\n";
+     cerr << "  -compare        : Com -decompose, resolve tambem a instancia inteira no mesmo tempo e\n";
+     cerr << "                    mostra a diferenca de bins (dobra o tempo de execucao).\n";
      cerr << "  <arquivo_entrada>: Arquivo contendo as instancias.\n";
  }
  
@@ -268,14 +247,78 @@
  
      // Identificação dos parametros para execução do código
      double time_limit = 0;
-     bool show_solution = false;
+     RunOptions opts;
+     OutputConfig out_config;
  
      for (int i = 1; i < argc; ++i) {
          if (strcmp(argv[i], "-time") == 0 && i + 1 < argc) {
              time_limit = stod(argv[++i]);
          }
          else if (strcmp(argv[i], "-s") == 0) {
-             show_solution = true;
+             out_config.show_solution = true;
+         }
+         else if (strcmp(argv[i], "-log") == 0 && i + 1 < argc) {
+             if (!parse_log_level(argv[++i], out_config.level)) {
+                 print_usage(argv[0]);
+                 return EXIT_FAILURE;
+             }
+         }
+         else if (strcmp(argv[i], "-json") == 0 && i + 1 < argc) {
+             out_config.json_path = argv[++i];
+         }
+         else if (strcmp(argv[i], "-csv") == 0 && i + 1 < argc) {
+             out_config.csv_path = argv[++i];
+         }
+         else if (strcmp(argv[i], "-noreduce") == 0) {
+             opts.solver.reduce = false;
+         }
+         else if (strcmp(argv[i], "-accept") == 0 && i + 1 < argc) {
+             string name = argv[++i];
+             if (name == "all") opts.accept = AcceptanceKind::All;
+             else if (name == "notworse") opts.accept = AcceptanceKind::NotWorse;
+             else {
+                 print_usage(argv[0]);
+                 return EXIT_FAILURE;
+             }
+         }
+         else if (strcmp(argv[i], "-ruin") == 0 && i + 1 < argc) {
+             string name = argv[++i];
+             if (name == "random") opts.solver.ruin = bp::RuinKind::RandomItems;
+             else if (name == "bins") opts.solver.ruin = bp::RuinKind::EmptiestBins;
+             else if (name == "related") opts.solver.ruin = bp::RuinKind::RelatedItems;
+             else {
+                 print_usage(argv[0]);
+                 return EXIT_FAILURE;
+             }
+             opts.solver.adaptive_ruin = false;
+         }
+         else if (strcmp(argv[i], "-noadapt") == 0) {
+             opts.solver.adaptive = false;
+         }
+         else if (strcmp(argv[i], "-decompose") == 0 && i + 1 < argc) {
+             opts.decomposition.parts = stoi(argv[++i]);
+             if (opts.decomposition.parts <= 0) opts.decomposition.parts = max(1u, thread::hardware_concurrency());
+         }
+         else if (strcmp(argv[i], "-compare") == 0) {
+             opts.compare = true;
+         }
+         else if (strcmp(argv[i], "-init") == 0 && i + 1 < argc) {
+             if (!parse_heuristics(argv[++i], opts.solver.heuristics)) {
+                 print_usage(argv[0]);
+                 return EXIT_FAILURE;
+             }
+         }
+         else if (strcmp(argv[i], "-seqinit") == 0) {
+             opts.solver.parallel_construction = false;
+         }
+         else if (strcmp(argv[i], "-recreate") == 0 && i + 1 < argc) {
+             string name = argv[++i];
+             if (name == "random") opts.solver.recreate = bp::RecreateOrder::Random;
+             else if (name == "decreasing") opts.solver.recreate = bp::RecreateOrder::DecreasingSize;
+             else {
+                 print_usage(argv[0]);
+                 return EXIT_FAILURE;
+             }
          }
      }
  
@@ -284,84 +327,25 @@
          return EXIT_FAILURE;
      }
  
-     // Leitura das instancias
-     vector<Instance> instances = read_instances(cin);
-     random_device rd;
-     mt19937 rng(rd());
-     cout << fixed << setprecision(2);
+     // Leitura das instancias em paralelo com a busca (no maximo READ_AHEAD instancias em espera)
+     const size_t READ_AHEAD = 2;
+     ResultWriter writer(out_config);
+     InstanceReader reader(cin, READ_AHEAD);
  
      auto start = chrono::steady_clock::now();
-     auto end = start + chrono::duration<double>(time_limit);
+     auto end = start + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(time_limit));
  
      int inst_counter = 0;
-     for (auto &inst : instances) {
+     PortfolioStats stats;
+     bp::Instance<double> inst;
+     while (chrono::steady_clock::now() < end && reader.next(inst)) {
          inst_counter++;
-         if (chrono::steady_clock::now() >= end) break;
- 
-         auto instance_start_time = chrono::steady_clock::now();
- 
-         // Solução inicial de forma gulosa via best fit
-         Solution best_sol = best_fit(inst.items, inst.capacity);
-         Fit best_fit = fitness(best_sol, inst.capacity);
-         Solution current_sol = best_sol;
- 
-         int perturb_strength = max(1, (int)(inst.n * 0.05));
- 
-         cout << "Instancia " << inst_counter << '\n';
-         cout << "   -> Solucao Inicial: Bins=" << best_fit.first << ", Waste=" << best_fit.second << '\n';
- 
-         int iterations = 0;
-         while (chrono::steady_clock::now() < end) {
-             iterations++;
-             double time_left_global = chrono::duration<double>(end - chrono::steady_clock::now()).count();
-             if (time_left_global <= 0) break;
- 
-             // '1. Perturbação da solução atual
-             Solution perturbed_sol = perturb(current_sol, inst.capacity, rng, perturb_strength);
- 
-             double ls_time = min({0.1, time_left_global * 0.1, time_left_global - 0.01});
-             if (ls_time <= 0) break;
- 
-             // '2. Busca local a partir da solução
-             Solution local_opt_sol = local_search(perturbed_sol, inst.capacity, ls_time);
- 
-             // '3. Avaliação da melhor solução vizinha
-             Fit local_opt_fit = fitness(local_opt_sol, inst.capacity);
- 
- 
-             // '3. Aceitação da solução (caso melhor)
-             if (local_opt_fit < best_fit) {
-                 best_sol = local_opt_sol;
-                 best_fit = local_opt_fit;
-                 current_sol = local_opt_sol;
-                 cout << "   -> Melhoria! Bins: " << best_fit.first << " (Iter: " << iterations << ")" << '\n';
-             } 
-             else {
-                 current_sol = local_opt_sol;
-             }
-             
-             // '4. Critério de parada
-             if (chrono::steady_clock::now() >= end) break;
-         }
- 
-         auto instance_end_time = chrono::steady_clock::now();
-         chrono::duration<double> instance_duration = instance_end_time - instance_start_time;
- 
-         cout << "Instancia " << inst_counter << ": Tempo=" << instance_duration.count() << "s, Iter=" << iterations
-              << ", Bins=" << best_fit.first << ", Waste=" << best_fit.second << '\n';
- 
-         if (show_solution) {
-             for (size_t i = 0; i < best_sol.size(); ++i) {
-                 cout << "  Bin " << setw(3) << i + 1 << " (" << fixed << setprecision(2) << accumulate(best_sol[i].begin(), best_sol[i].end(), 0.0) << "/" << inst.capacity << "): ";
-                 for (auto item : best_sol[i]) {
-                     cout << item << " ";
-                 }
-                 cout << '\n';
-             }
-         }
-         cout << "---------------------------------------------------" << '\n';
- 
+         dispatch(move(inst), opts, end, writer, stats, inst_counter);
      }
+     if (stats.any()) writer.message(LogLevel::Info, stats.summary());
+ 
+     reader.stop();
+     writer.close();
  
      return EXIT_SUCCESS;
  }
\ No newline at end of file
@@ -0,0 +1,101 @@
+/*
+ * Implementação de uma Meta-heurística de Solução Única para o Bin Packing.
+ * (Iterated Local Search - ILS)
+ * 
+ * 1. Representação da Solução:
+ * - Os itens são agrupados em classes "ItemClass" (tamanho, quantidade), ordenadas por
+ *   tamanho decrescente (counting sort quando os tamanhos são inteiros).
+ * - Uma solução é representada por "Solution", que é um "vector<Bin>".
+ * - Cada "Bin" guarda suas "Entry" (classe, cópias), a carga e o número de itens, de modo
+ *   que o custo das operações depende do número de classes distintas, e não de n.
+ * - A solução mantém um índice dos bins ordenado pela folga, usado pelo Best Fit, pela
+ *   busca local e pela perturbação para achar o bin mais justo em O(log bins).
+ * - "expand" converte para a lista explícita de itens ("PlainSolution") apenas na saída.
+ *
+ * 2. Função de Avaliação:
+ * - A função "fitness(Solution, capacity)" calcula a qualidade de uma solução.
+ * - Retorna um "pair<int, double>":
+ * - first: O número de bins utilizados - objetivo primário a minimizar.
+ * - second: O desperdício total (soma das capacidades não utilizadas em cada bin) - objetivo secundário a minimizar.
+ * - Comparações entre "Fit" priorizam o número de bins, depois o desperdício.
+ *
+ * 3. Geração da Solução Inicial (constructive.hpp):
+ * - Um portfólio de heurísticas construtivas é executado em paralelo, uma thread por
+ *   heurística, e a solução com menos bins inicia o ILS: First Fit e Best Fit (ordem da
+ *   entrada), First Fit Decreasing e Best Fit Decreasing (classes já ordenadas), Minimum
+ *   Bin Slack e Sum-of-Squares. O subconjunto executado é configurável.
+ * - No Best Fit, cada item é inserido no bin onde ele melhor se encaixa (deixando o menor
+ *   espaço residual), dentre os bins onde ele cabe. Se não couber em nenhum, um novo bin
+ *   é criado; o First Fit usa o primeiro bin onde o item cabe (árvore de máximos).
+ * - As cópias de uma classe são inseridas em blocos: o bin escolhido recebe de uma vez
+ *   todas as cópias que couberem.
+ *
+ * 4. Estratégia de Busca Local:
+ * - A função "local_search" implementa a busca local.
+ * - Vizinhança Explorada: Foca em bins que contêm *apenas uma classe* (k cópias). Tenta mover
+ * as k cópias de uma vez para outro bin existente onde caibam, escolhendo o bin destino que
+ * resulta no menor espaço residual após a inserção (estratégia 'best fit' para a movimentação).
+ * Se nenhum bin comporta todas, tenta distribuí-las em blocos entre vários bins.
+ * - Tipo de Busca: É uma forma de Best Improvement dentro da vizinhança. A busca
+ * para assim que uma melhoria é encontrada. O processo se repete até que nenhuma melhoria 
+ * desse tipo seja possível ou o tempo limite se esgote.
+ *
+ * 5. Perturbação (ruin-and-recreate, perturbation.hpp):
+ * - Remove cerca de "p" itens e os reinsere com Best Fit em blocos.
+ * - Ruína: itens aleatórios (amostragem com rejeição, sem embaralhar a lista de todos os
+ *   itens), os bins mais vazios inteiros ou itens de tamanho parecido com uma semente.
+ * - Recriação: ordem aleatória das classes ou tamanho decrescente.
+ * - O índice de folgas da solução torna o custo O(p log bins) em vez de O(n).
+ * - Controle adaptativo (adaptive.hpp): a ruína e a força "p" de cada iteração são
+ *   escolhidas por um bandit epsilon-guloso, pela taxa recente de progresso por segundo
+ *   de cada par (ruína, força); o progresso inclui a folga do bin mais vazio.
+ *
+ * 6. Critério de Parada:
+ * - O algoritmo executa iterações de perturbação e busca local até que um tempo limite
+ * global ("time_limit"), fornecido como argumento de linha de comando, seja atingido.
+ *
+ * 6.1 Laço sem cópias:
+ * - O ILS trabalha numa única solução: perturbação e busca local alteram a solução no
+ *   lugar e cada movimento é anotado num registro de desfazer. Conforme o critério de
+ *   aceitação, a iteração é confirmada ("commit") ou desfeita ("rollback"), e a melhor
+ *   solução só é copiada quando melhora.
+ *
+ * 7. Pré-processamento (Redução de Martello-Toth):
+ * - Antes da busca, "reduce_instance" fixa bins que comprovadamente existem em alguma
+ *   solução ótima, e a busca trabalha apenas com os itens restantes:
+ *   R1 (isolado): o item não cabe junto com nenhum outro -> bin só com ele.
+ *   R2 (par exato): dois itens que enchem exatamente o bin -> bin com o par.
+ *   R3 (par dominante): o item não cabe junto com os dois menores itens restantes,
+ *      logo divide o bin com no máximo um item -> par com o maior item que cabe.
+ * - As regras são aplicadas do maior para o menor item até não haver mudança, e os bins
+ *   fixados são reincorporados à solução na saída.
+ *
+ * 8. Biblioteca:
+ * - Este cabeçalho reúne a biblioteca header-only, no namespace "bp":
+ *   instance.hpp (Instance, classes e leitura), solution.hpp (representação, fitness e
+ *   Best Fit), constructive.hpp, reduction.hpp, perturbation.hpp, adaptive.hpp,
+ *   policies.hpp, solver.hpp e decomposition.hpp (modo de decomposição para instâncias
+ *   muito grandes: partes estratificadas por tamanho, resolvidas em paralelo, e reparo
+ *   dos bins menos cheios).
+ * - "Solver<Size, Neighborhood, Acceptance>" recebe o tipo de item (int ou double), a
+ *   vizinhança da busca local e o critério de aceitação como parâmetros de template, de
+ *   modo que cada combinação gera um laço principal sem despacho virtual.
+ * - A configuração ("SolverConfig") e o resultado ("SolverResult") são structs simples;
+ *   o progresso da busca é informado a um observador passado para "solve".
+ * - bin_packing.cpp é apenas o front end de linha de comando sobre a biblioteca.
+ *
+ */
+#ifndef BIN_PACKING_HPP
+#define BIN_PACKING_HPP
+
+#include "adaptive.hpp"
+#include "constructive.hpp"
+#include "decomposition.hpp"
+#include "instance.hpp"
+#include "perturbation.hpp"
+#include "policies.hpp"
+#include "reduction.hpp"
+#include "solution.hpp"
+#include "solver.hpp"
+
+#endif
@@ -0,0 +1,309 @@
+// Heurísticas construtivas e o portfólio que as executa em paralelo no início da busca.
+#ifndef CONSTRUCTIVE_HPP
+#define CONSTRUCTIVE_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "instance.hpp"
+#include "solution.hpp"
+
+namespace bp {
+
+using Clock = std::chrono::steady_clock;
+
+enum Heuristic { FIRST_FIT, BEST_FIT, FIRST_FIT_DECREASING, BEST_FIT_DECREASING, MIN_BIN_SLACK, SUM_OF_SQUARES, NUM_HEURISTICS };
+
+inline const char *heuristic_name(int h) {
+    static const char *names[NUM_HEURISTICS] = {"FF", "BF", "FFD", "BFD", "MBS", "SS"};
+    return names[h];
+}
+
+// Conjunto de heurísticas como máscara de bits (bit h = heurística h)
+const unsigned ALL_HEURISTICS = (1u << NUM_HEURISTICS) - 1;
+
+// Sequência de blocos (classe, cópias) na ordem original dos itens; itens iguais
+// consecutivos formam um único bloco
+template <typename Size>
+std::vector<Entry> item_blocks(const std::vector<Size> &items, const Classes<Size> &classes) {
+    std::vector<Entry> blocks;
+    for (Size item : items) {
+        // As classes estão em ordem decrescente de tamanho
+        int cls = std::lower_bound(classes.begin(), classes.end(), item,
+                                   [](const ItemClass<Size> &c, Size s) { return c.size > s; }) - classes.begin();
+        if (!blocks.empty() && blocks.back().cls == cls) blocks.back().count++;
+        else blocks.push_back({cls, 1});
+    }
+    return blocks;
+}
+
+// Classes em ordem decrescente, uma por bloco
+template <typename Size>
+std::vector<Entry> decreasing_blocks(const Classes<Size> &classes) {
+    std::vector<Entry> blocks(classes.size());
+    for (size_t c = 0; c < classes.size(); ++c) blocks[c] = {(int)c, classes[c].count};
+    return blocks;
+}
+
+// Árvore de máximos sobre as folgas dos bins: o primeiro bin (menor índice) com folga
+// suficiente é achado em O(log bins). Posições sem bin aberto têm folga -1.
+template <typename Size>
+class FirstFitIndex {
+public:
+    explicit FirstFitIndex(int max_bins) {
+        while (leaves < max_bins) leaves <<= 1;
+        tree.assign(2 * leaves, Size(-1));
+    }
+
+    int first(Size size) const {
+        const Size need = size - ItemTraits<Size>::eps;
+        if (tree[1] < need) return -1;
+        int i = 1;
+        while (i < leaves) i = tree[2 * i] >= need ? 2 * i : 2 * i + 1;
+        return i - leaves;
+    }
+
+    void set(int b, Size slack) {
+        int i = b + leaves;
+        tree[i] = slack;
+        for (i >>= 1; i > 0; i >>= 1) tree[i] = std::max(tree[2 * i], tree[2 * i + 1]);
+    }
+
+private:
+    int leaves = 1;
+    std::vector<Size> tree;
+};
+
+// First Fit em blocos: o primeiro bin que comporta o item recebe todas as cópias que
+// couberem, o que equivale a inserir as cópias uma a uma
+template <typename Size>
+Solution<Size> first_fit(const std::vector<Entry> &blocks, const Classes<Size> &classes, Size capacity) {
+    int total = 0;
+    for (const auto &blk : blocks) total += blk.count;
+    Solution<Size> bins(capacity);
+    FirstFitIndex<Size> index(std::max(1, total));
+    for (const auto &blk : blocks) {
+        Size size = classes[blk.cls].size;
+        int count = blk.count;
+        while (count > 0) {
+            int b = index.first(size);
+            if (b == -1) b = bins.open_bin();
+            int copies = std::min(count, std::max(1, copies_that_fit(bins[b].load, size, capacity)));
+            bins.add(b, blk.cls, copies, classes);
+            index.set(b, bins.slack_of(b));
+            count -= copies;
+        }
+    }
+    return bins;
+}
+
+// Best Fit em blocos sobre uma sequência qualquer (ver "best_fit_insert")
+template <typename Size>
+Solution<Size> best_fit(const std::vector<Entry> &blocks, const Classes<Size> &classes, Size capacity) {
+    Solution<Size> bins(capacity);
+    for (const auto &blk : blocks) {
+        best_fit_insert(bins, blk.cls, blk.count, classes, capacity);
+    }
+    return bins;
+}
+
+// Minimum Bin Slack (Gupta e Ho): cada bin é preenchido com o subconjunto dos itens
+// restantes que deixa a menor folga, sempre contendo o maior item restante. A busca
+// em profundidade sobre as classes examina no máximo "node_limit" classes por bin.
+// Com muitas classes o custo é quase quadrático: devolve nullopt se "deadline" passar.
+template <typename Size>
+std::optional<Solution<Size>> minimum_bin_slack(const Classes<Size> &classes, Size capacity,
+                                                Clock::time_point deadline = Clock::time_point::max(),
+                                                long node_limit = 10000) {
+    const Size EPS = ItemTraits<Size>::eps;
+    std::vector<int> left(classes.size());
+    for (size_t c = 0; c < classes.size(); ++c) left[c] = classes[c].count;
+
+    std::vector<int> chosen, best_chosen;
+    Size best_slack = capacity;
+    long nodes = 0;
+
+    std::function<void(size_t, Size)> search = [&](size_t from, Size slack) {
+        if (slack < best_slack) {
+            best_slack = slack;
+            best_chosen = chosen;
+        }
+        // Pula as classes que não cabem (ordem decrescente de tamanho)
+        size_t start = std::lower_bound(classes.begin() + from, classes.end(), slack + EPS,
+                                        [](const ItemClass<Size> &c, Size s) { return c.size > s; }) - classes.begin();
+        for (size_t c = start; c < classes.size() && best_slack > EPS && nodes < node_limit; ++c) {
+            nodes++;
+            if (left[c] == 0) continue;
+            left[c]--;
+            chosen.push_back(c);
+            search(c, slack - classes[c].size);
+            chosen.pop_back();
+            left[c]++;
+        }
+    };
+
+    Solution<Size> bins(capacity);
+    size_t largest = 0;
+    while (true) {
+        while (largest < classes.size() && left[largest] == 0) ++largest;
+        if (largest == classes.size()) break;
+        if (Clock::now() > deadline) return std::nullopt;
+
+        left[largest]--;
+        chosen.assign(1, largest);
+        best_chosen = chosen;
+        best_slack = capacity - classes[largest].size;
+        nodes = 0;
+        search(largest, best_slack);
+        left[largest]++;
+
+        int b = bins.open_bin();
+        for (int c : best_chosen) {
+            left[c]--;
+            bins.add(b, c, 1, classes);
+        }
+    }
+    return bins;
+}
+
+// Sum-of-Squares (Csirik et al.): com N(g) bins de folga g, cada item vai para o bin
+// (ou bin novo) que minimiza a soma de N(g)^2 após a inserção; bins cheios não contam.
+// Empates favorecem a menor folga resultante. Cada item percorre as folgas distintas, então
+// com itens fracionários o custo também é quase quadrático: devolve nullopt se "deadline"
+// passar.
+template <typename Size>
+std::optional<Solution<Size>> sum_of_squares(const std::vector<Entry> &blocks, const Classes<Size> &classes,
+                                             Size capacity, Clock::time_point deadline = Clock::time_point::max()) {
+    const Size EPS = ItemTraits<Size>::eps;
+    Solution<Size> bins(capacity);
+    std::map<Size, std::vector<int>> by_gap; // folga -> bins com essa folga (exceto cheios)
+
+    auto count_of = [&](Size gap) -> long {
+        if (gap <= EPS) return -1; // Bins cheios não entram na soma
+        auto it = by_gap.find(gap);
+        return it == by_gap.end() ? 0 : (long)it->second.size();
+    };
+
+    long inserted = 0;
+    for (const auto &blk : blocks) {
+        Size size = classes[blk.cls].size;
+        for (int k = 0; k < blk.count; ++k) {
+            if (++inserted % 64 == 0 && Clock::now() > deadline) return std::nullopt;
+            // Bin novo: só a folga C - s ganha um bin
+            long n_new = count_of(capacity - size);
+            long best_delta = n_new < 0 ? 0 : 2 * n_new + 1;
+            Size best_gap = capacity;
+            for (auto it = by_gap.lower_bound(size - EPS); it != by_gap.end(); ++it) {
+                long n_from = it->second.size();
+                long n_to = count_of(it->first - size);
+                long delta = (1 - 2 * n_from) + (n_to < 0 ? 0 : 2 * n_to + 1);
+                if (delta < best_delta || (delta == best_delta && it->first < best_gap)) {
+                    best_delta = delta;
+                    best_gap = it->first;
+                }
+            }
+
+            int b;
+            if (best_gap == capacity && by_gap.find(capacity) == by_gap.end()) {
+                b = bins.open_bin();
+            }
+            else {
+                auto it = by_gap.find(best_gap);
+                b = it->second.back();
+                it->second.pop_back();
+                if (it->second.empty()) by_gap.erase(it);
+            }
+            bins.add(b, blk.cls, 1, classes);
+            if (bins.slack_of(b) > EPS) by_gap[bins.slack_of(b)].push_back(b);
+        }
+    }
+    return bins;
+}
+
+// Solução da heurística; nullopt se ela foi interrompida por "deadline" (só MBS e SS, as
+// demais são O(n log n) e sempre terminam)
+template <typename Size>
+std::optional<Solution<Size>> construct(int heuristic, const std::vector<Size> &items, const Classes<Size> &classes,
+                                        Size capacity, Clock::time_point deadline = Clock::time_point::max()) {
+    switch (heuristic) {
+    case FIRST_FIT: return first_fit(item_blocks(items, classes), classes, capacity);
+    case BEST_FIT: return best_fit(item_blocks(items, classes), classes, capacity);
+    case FIRST_FIT_DECREASING: return first_fit(decreasing_blocks(classes), classes, capacity);
+    case MIN_BIN_SLACK: return minimum_bin_slack(classes, capacity, deadline);
+    case SUM_OF_SQUARES: return sum_of_squares(item_blocks(items, classes), classes, capacity, deadline);
+    default: return best_fit(classes, capacity);
+    }
+}
+
+struct ConstructionRun {
+    int heuristic;
+    int bins;    // -1: interrompida pelo prazo
+    double time; // Segundos
+};
+
+template <typename Size>
+struct Portfolio {
+    std::vector<ConstructionRun> runs; // Uma por heurística selecionada, na ordem de "Heuristic"
+    int winner = BEST_FIT_DECREASING;
+    Solution<Size> best;
+};
+
+// Executa as heurísticas de "mask" (cada uma na sua thread se "parallel") e fica com a
+// solução de menos bins; empates favorecem a ordem de "Heuristic". As heurísticas que
+// passam de "deadline" são descartadas; se nenhuma terminar, vale a BFD.
+template <typename Size>
+Portfolio<Size> run_portfolio(const std::vector<Size> &items, const Classes<Size> &classes, Size capacity,
+                              unsigned mask, bool parallel = true,
+                              Clock::time_point deadline = Clock::time_point::max()) {
+    Portfolio<Size> portfolio;
+    portfolio.best = Solution<Size>(capacity);
+    if (items.empty()) return portfolio;
+    if ((mask & ALL_HEURISTICS) == 0) mask = 1u << BEST_FIT_DECREASING;
+
+    std::vector<int> selected;
+    for (int h = 0; h < NUM_HEURISTICS; ++h) {
+        if (mask & (1u << h)) selected.push_back(h);
+    }
+    std::vector<std::optional<Solution<Size>>> sols(selected.size());
+    std::vector<double> times(selected.size());
+
+    auto run = [&](size_t i) {
+        auto t0 = Clock::now();
+        sols[i] = construct(selected[i], items, classes, capacity, deadline);
+        times[i] = std::chrono::duration<double>(Clock::now() - t0).count();
+    };
+
+    if (parallel && selected.size() > 1) {
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < selected.size(); ++i) workers.emplace_back(run, i);
+        run(0);
+        for (auto &w : workers) w.join();
+    }
+    else {
+        for (size_t i = 0; i < selected.size(); ++i) run(i);
+    }
+
+    int best = -1;
+    for (size_t i = 0; i < selected.size(); ++i) {
+        portfolio.runs.push_back({selected[i], sols[i] ? (int)sols[i]->size() : -1, times[i]});
+        if (sols[i] && (best < 0 || sols[i]->size() < sols[best]->size())) best = i;
+    }
+    if (best < 0) {
+        portfolio.winner = BEST_FIT_DECREASING;
+        portfolio.best = best_fit(classes, capacity);
+    }
+    else {
+        portfolio.winner = selected[best];
+        portfolio.best = std::move(*sols[best]);
+    }
+    return portfolio;
+}
+
+}  // namespace bp
+
+#endif
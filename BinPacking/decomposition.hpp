@@ -0,0 +1,209 @@
+// Modo de decomposição para instâncias muito grandes.
+//
+// 1. Partição estratificada: as cópias de cada classe (tamanho) são distribuídas de forma
+//    equilibrada entre as k partes, de modo que cada sub-instância tem aproximadamente a
+//    mesma distribuição de tamanhos e 1/k dos itens.
+// 2. Cada parte é resolvida por um Solver independente, uma thread por parte, durante a
+//    fração "part_time" do tempo disponível.
+// 3. Junção e reparo: os bins de todas as partes são reunidos; os bins menos cheios (de
+//    partes diferentes) são esvaziados e seus itens são resolvidos juntos no tempo
+//    restante. O reparo só substitui esses bins se usar menos bins.
+#ifndef DECOMPOSITION_HPP
+#define DECOMPOSITION_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "instance.hpp"
+#include "solver.hpp"
+
+namespace bp {
+
+struct DecompositionConfig {
+    int parts = 0;           // Número de sub-instâncias; 0 desativa a decomposição
+    double part_time = 0.7;  // Fração do tempo dada às partes; o restante vai para o reparo
+    double repair_pool = 1.0; // Itens do reparo, em múltiplos do tamanho médio de uma parte
+    int min_part_items = 1000; // Partes menores que isso não compensam: k é reduzido
+};
+
+struct DecompositionStats {
+    int parts = 0;
+    double part_time = 0.0;  // Segundos até a última parte terminar
+    int merged_bins = 0;     // Bins após a junção das partes
+    int repair_in = 0;       // Bins esvaziados pelo reparo
+    int repair_out = 0;      // Bins usados pelo reparo para os mesmos itens
+    long long iterations = 0; // Iterações somadas de todos os workers
+    int lower_bound = 0;     // Limite inferior L1 = ceil(soma dos itens / C)
+};
+
+// Distribui as cópias de cada classe entre as partes; a sobra de cada classe começa na
+// parte seguinte à da classe anterior, para equilibrar o número de itens
+template <typename Size>
+std::vector<Instance<Size>> partition_instance(const Instance<Size> &inst, int parts) {
+    Classes<Size> classes = compress_items(inst.items);
+    std::vector<Instance<Size>> out(parts);
+    for (auto &part : out) {
+        part.capacity = inst.capacity;
+        part.items.reserve(inst.items.size() / parts + classes.size());
+    }
+    int next = 0;
+    for (const auto &cls : classes) {
+        for (int j = 0; j < parts; ++j) {
+            int share = cls.count / parts + ((j - next + parts) % parts < cls.count % parts ? 1 : 0);
+            out[j].items.insert(out[j].items.end(), share, cls.size);
+        }
+        next = (next + cls.count % parts) % parts;
+    }
+    for (auto &part : out) part.n = part.items.size();
+    return out;
+}
+
+template <typename Size>
+int l1_bound(const Instance<Size> &inst) {
+    double total = std::accumulate(inst.items.begin(), inst.items.end(), 0.0);
+    return (int)std::ceil(total / inst.capacity - 1e-9);
+}
+
+template <typename Size, typename Neighborhood = SingleClassRelocation, typename Acceptance = AcceptAll,
+          typename Listener = NullListener>
+SolverResult<Size> solve_decomposed(const Instance<Size> &inst, const SolverConfig &config,
+                                    const DecompositionConfig &decomp, Clock::time_point deadline,
+                                    DecompositionStats &stats, Listener &&listener = Listener()) {
+    auto start = Clock::now();
+    const int k = std::max(1, std::min(decomp.parts, inst.n / std::max(1, decomp.min_part_items)));
+    stats = DecompositionStats();
+    stats.parts = k;
+    stats.lower_bound = l1_bound(inst);
+
+    // Instância pequena demais para dividir: solver monolítico
+    if (k == 1) {
+        Solver<Size, Neighborhood, Acceptance> solver(inst, config);
+        SolverResult<Size> result = solver.solve(deadline, listener);
+        stats.part_time = result.time;
+        stats.merged_bins = stats.repair_in = stats.repair_out = result.best_fit.first;
+        stats.iterations = result.iterations;
+        return result;
+    }
+
+    // As partes já rodam em paralelo: o portfólio de cada uma é sequencial
+    SolverConfig part_config = config;
+    part_config.parallel_construction = false;
+
+    std::vector<Instance<Size>> parts = partition_instance(inst, k);
+    std::vector<SolverResult<Size>> part_results(k);
+    auto part_deadline = start + std::chrono::duration_cast<Clock::duration>((deadline - start) * decomp.part_time);
+
+    std::vector<std::thread> workers;
+    for (int j = 0; j < k; ++j) {
+        workers.emplace_back([&, j] {
+            SolverConfig cfg = part_config;
+            if (cfg.seed) cfg.seed += j;
+            Solver<Size, Neighborhood, Acceptance> solver(std::move(parts[j]), cfg);
+            part_results[j] = solver.solve(part_deadline);
+        });
+    }
+    for (auto &w : workers) w.join();
+    stats.part_time = std::chrono::duration<double>(Clock::now() - start).count();
+
+    // Junção: os totais das partes são somados (classes e itens restantes contam uma vez
+    // por parte); os bins fixados pelas reduções ficam no início da solução, como no solver
+    // monolítico. A heurística inicial informada é a que venceu o portfólio em mais partes,
+    // e cada heurística do portfólio aparece uma vez, com os bins e o tempo somados das
+    // partes (bins -1 se foi interrompida em alguma).
+    SolverResult<Size> result;
+    PlainSolution<Size> bins, searched;
+    int wins[NUM_HEURISTICS] = {};
+    ConstructionRun runs[NUM_HEURISTICS];
+    bool ran[NUM_HEURISTICS] = {};
+    for (auto &res : part_results) {
+        stats.iterations += res.iterations;
+        wins[res.initial_heuristic]++;
+        for (int r = 0; r < NUM_RULES; ++r) {
+            result.reduction.items_removed[r] += res.reduction.items_removed[r];
+            result.reduction.bins_fixed[r] += res.reduction.bins_fixed[r];
+        }
+        result.fixed_bins += res.fixed_bins;
+        result.remaining_items += res.remaining_items;
+        result.num_classes += res.num_classes;
+        for (const auto &run : res.construction) {
+            ConstructionRun &total = runs[run.heuristic];
+            if (!ran[run.heuristic]) total = {run.heuristic, 0, 0.0};
+            ran[run.heuristic] = true;
+            total.bins = total.bins < 0 || run.bins < 0 ? -1 : total.bins + run.bins;
+            total.time += run.time;
+        }
+        bins.insert(bins.end(), std::make_move_iterator(res.solution.begin()),
+                    std::make_move_iterator(res.solution.begin() + res.fixed_bins));
+        searched.insert(searched.end(), std::make_move_iterator(res.solution.begin() + res.fixed_bins),
+                        std::make_move_iterator(res.solution.end()));
+    }
+    part_results.clear();
+    bins.insert(bins.end(), std::make_move_iterator(searched.begin()), std::make_move_iterator(searched.end()));
+    searched.clear();
+    stats.merged_bins = bins.size();
+    result.initial_heuristic = std::max_element(wins, wins + NUM_HEURISTICS) - wins;
+    for (int h = 0; h < NUM_HEURISTICS; ++h) {
+        if (ran[h]) result.construction.push_back(runs[h]);
+    }
+
+    result.initial_fit = fitness(bins, inst.capacity);
+    listener.on_start(result);
+
+    // Reparo: esvazia os bins menos cheios (exceto os fixados) até juntar cerca de
+    // n/k * repair_pool itens
+    std::vector<std::pair<double, int>> by_load;
+    by_load.reserve(bins.size() - result.fixed_bins);
+    for (size_t b = result.fixed_bins; b < bins.size(); ++b) {
+        by_load.push_back({std::accumulate(bins[b].begin(), bins[b].end(), 0.0), (int)b});
+    }
+    std::sort(by_load.begin(), by_load.end());
+
+    size_t target = std::max<size_t>(2, (size_t)(inst.n / k * decomp.repair_pool));
+    Instance<Size> pool;
+    pool.capacity = inst.capacity;
+    std::vector<int> taken;
+    for (const auto &entry : by_load) {
+        if (pool.items.size() >= target && taken.size() >= 2) break;
+        const auto &bin = bins[entry.second];
+        pool.items.insert(pool.items.end(), bin.begin(), bin.end());
+        taken.push_back(entry.second);
+    }
+    pool.n = pool.items.size();
+    stats.repair_in = taken.size();
+    stats.repair_out = taken.size();
+
+    if (taken.size() >= 2 && Clock::now() < deadline) {
+        Solver<Size, Neighborhood, Acceptance> repair(std::move(pool), config);
+        SolverResult<Size> rep = repair.solve(deadline);
+        stats.iterations += rep.iterations;
+        if ((int)rep.solution.size() < stats.repair_in) {
+            stats.repair_out = rep.solution.size();
+            std::sort(taken.begin(), taken.end(), std::greater<int>());
+            for (int b : taken) {
+                if (b + 1 != (int)bins.size()) bins[b] = std::move(bins.back());
+                bins.pop_back();
+            }
+            bins.insert(bins.end(), std::make_move_iterator(rep.solution.begin()),
+                        std::make_move_iterator(rep.solution.end()));
+        }
+    }
+
+    result.best_fit = fitness(bins, inst.capacity);
+    result.iterations = stats.iterations;
+    result.time = std::chrono::duration<double>(Clock::now() - start).count();
+    if (result.best_fit < result.initial_fit) {
+        listener.on_improvement(result.iterations, result.best_fit, result.time);
+    }
+    if constexpr (wants_solutions_v<Listener>) listener.on_solution(bins);
+    result.solution = std::move(bins);
+    return result;
+}
+
+}  // namespace bp
+
+#endif
@@ -0,0 +1,57 @@
+#include "input.hpp"
+
+#include <utility>
+
+using namespace std;
+
+InstanceReader::InstanceReader(istream &in, size_t capacity) : in(in), capacity(capacity ? capacity : 1) {
+    worker = thread(&InstanceReader::run, this);
+}
+
+InstanceReader::~InstanceReader() {
+    stop();
+}
+
+bool InstanceReader::next(bp::Instance<double> &inst) {
+    unique_lock<mutex> lock(mtx);
+    not_empty.wait(lock, [&] { return !queue.empty() || finished || stopped; });
+    if (queue.empty() || stopped) return false;
+    inst = move(queue.front());
+    queue.pop_front();
+    lock.unlock();
+    not_full.notify_one();
+    return true;
+}
+
+void InstanceReader::stop() {
+    {
+        lock_guard<mutex> lock(mtx);
+        stopped = true;
+        queue.clear();
+    }
+    not_full.notify_one();
+    not_empty.notify_one();
+    if (worker.joinable()) worker.join();
+}
+
+void InstanceReader::run() {
+    // Mesmo formato de bp::read_instances: "P" seguido de P instancias
+    int P = 0;
+    in >> P;
+    for (int p = 0; p < P; ++p) {
+        bp::Instance<double> inst;
+        if (!bp::read_instance(in, inst)) break;
+
+        unique_lock<mutex> lock(mtx);
+        not_full.wait(lock, [&] { return queue.size() < capacity || stopped; });
+        if (stopped) return;
+        queue.push_back(move(inst));
+        lock.unlock();
+        not_empty.notify_one();
+    }
+    {
+        lock_guard<mutex> lock(mtx);
+        finished = true;
+    }
+    not_empty.notify_one();
+}
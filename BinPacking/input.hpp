@@ -0,0 +1,51 @@
+/*
+ * Leitura das instancias em pipeline.
+ *
+ * - Uma thread leitora analisa a entrada e entrega as instancias, na ordem do arquivo,
+ *   por uma fila limitada: enquanto a instancia k e resolvida, a k+1 ja esta sendo lida.
+ * - A fila limitada impede que o arquivo inteiro fique em memoria; a leitora espera
+ *   quando a fila esta cheia e a instancia so vive ate o seu resultado ser emitido.
+ * - "stop()" (ou o destrutor) libera a leitora quando a busca termina antes do fim
+ *   do arquivo (tempo limite esgotado).
+ */
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <istream>
+#include <mutex>
+#include <thread>
+
+#include "instance.hpp"
+
+class InstanceReader {
+public:
+    // "capacity": numero maximo de instancias ja lidas aguardando a busca
+    InstanceReader(std::istream &in, size_t capacity);
+    ~InstanceReader();
+
+    InstanceReader(const InstanceReader &) = delete;
+    InstanceReader &operator=(const InstanceReader &) = delete;
+
+    // Bloqueia ate a proxima instancia; falso no fim da entrada (ou apos stop()).
+    bool next(bp::Instance<double> &inst);
+
+    // Interrompe a leitura e aguarda o fim da thread leitora.
+    void stop();
+
+private:
+    void run();
+
+    std::istream &in;
+    size_t capacity;
+    std::deque<bp::Instance<double>> queue;
+    bool finished = false;  // A leitora chegou ao fim da entrada
+    bool stopped = false;   // O consumidor nao quer mais instancias
+    std::mutex mtx;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    std::thread worker;
+};
+
+#endif
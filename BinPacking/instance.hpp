@@ -0,0 +1,119 @@
+// Instância do Bin Packing, representação comprimida por classes e leitura da entrada.
+#ifndef INSTANCE_HPP
+#define INSTANCE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <istream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bp {
+
+// Política de tipo de item: tamanhos inteiros usam aritmética exata,
+// tamanhos reais toleram o erro acumulado nas cargas.
+template <typename Size>
+struct ItemTraits {
+    static constexpr Size eps = std::is_floating_point<Size>::value ? Size(1e-9) : Size(0);
+};
+
+template <typename Size>
+struct Instance {
+    Size capacity = 0;
+    int n = 0;
+    std::vector<Size> items;
+};
+
+// Itens de mesmo tamanho formam uma classe (tamanho, quantidade)
+template <typename Size>
+struct ItemClass {
+    Size size;
+    int count;
+};
+
+template <typename Size>
+using Classes = std::vector<ItemClass<Size>>;
+
+template <typename Size>
+using PlainBin = std::vector<Size>;
+
+template <typename Size>
+using PlainSolution = std::vector<PlainBin<Size>>;
+
+// Agrupa os itens em classes ordenadas por tamanho decrescente.
+// Tamanhos inteiros de faixa moderada usam counting sort (O(n + maior tamanho)).
+template <typename Size>
+Classes<Size> compress_items(const std::vector<Size> &items) {
+    Classes<Size> classes;
+    if (items.empty()) return classes;
+
+    const double MAX_COUNTING_SIZE = 1 << 22;
+    Size max_size = *std::max_element(items.begin(), items.end());
+    bool integral = max_size <= MAX_COUNTING_SIZE &&
+                    std::all_of(items.begin(), items.end(), [](Size x) { return x >= 0 && x == std::floor(x); });
+
+    if (integral) {
+        std::vector<int> counts((size_t)max_size + 1, 0);
+        for (auto item : items) counts[(size_t)item]++;
+        for (size_t s = counts.size(); s-- > 0;) {
+            if (counts[s] > 0) classes.push_back({(Size)s, counts[s]});
+        }
+        return classes;
+    }
+
+    std::vector<Size> sorted(items);
+    std::sort(sorted.begin(), sorted.end(), std::greater<Size>());
+    for (auto item : sorted) {
+        if (classes.empty() || classes.back().size != item) classes.push_back({item, 0});
+        classes.back().count++;
+    }
+    return classes;
+}
+
+// Lê uma instância: "capacidade n" seguido dos n tamanhos
+template <typename Size>
+bool read_instance(std::istream &in, Instance<Size> &inst) {
+    if (!(in >> inst.capacity >> inst.n)) return false;
+    inst.items.resize(inst.n);
+    for (int i = 0; i < inst.n; ++i) {
+        in >> inst.items[i];
+    }
+    return (bool)in;
+}
+
+// Lê o arquivo completo: "P" seguido de P instâncias
+template <typename Size>
+std::vector<Instance<Size>> read_instances(std::istream &in) {
+    int P = 0;
+    in >> P;
+    std::vector<Instance<Size>> instances;
+    instances.reserve(P);
+    for (int p = 0; p < P; ++p) {
+        Instance<Size> inst;
+        if (!read_instance(in, inst)) break;
+        instances.push_back(std::move(inst));
+    }
+    return instances;
+}
+
+// Verdadeiro se todos os tamanhos (e a capacidade) são inteiros representáveis em "int"
+template <typename Size>
+bool is_integral_instance(const Instance<Size> &inst) {
+    auto integral = [](Size x) { return x == std::floor(x) && std::fabs((double)x) < 1e9; };
+    return integral(inst.capacity) && std::all_of(inst.items.begin(), inst.items.end(), integral);
+}
+
+template <typename To, typename From>
+Instance<To> convert_instance(const Instance<From> &inst) {
+    Instance<To> out;
+    out.capacity = (To)inst.capacity;
+    out.n = inst.n;
+    out.items.assign(inst.items.begin(), inst.items.end());
+    return out;
+}
+
+}  // namespace bp
+
+#endif
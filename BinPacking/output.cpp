@@ -0,0 +1,303 @@
+#include "output.hpp"
+
+#include <charconv>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+
+using namespace std;
+
+namespace {
+
+const size_t QUEUE_CAPACITY = 1 << 12;
+const size_t FLUSH_THRESHOLD = 1 << 16;
+
+void append_int(string &out, long long value) {
+    char buf[24];
+    auto res = to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, res.ptr);
+}
+
+void append_fixed(string &out, double value, int precision) {
+    char buf[64];
+    auto res = to_chars(buf, buf + sizeof(buf), value, chars_format::fixed, precision);
+    out.append(buf, res.ptr);
+}
+
+// Menor representação que relida dá exatamente o mesmo double
+void append_shortest(string &out, double value) {
+    char buf[32];
+    auto res = to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, res.ptr);
+}
+
+void append_padded(string &out, long long value, size_t width) {
+    char buf[24];
+    auto res = to_chars(buf, buf + sizeof(buf), value);
+    size_t len = res.ptr - buf;
+    if (len < width) out.append(width - len, ' ');
+    out.append(buf, res.ptr);
+}
+
+void write_file(FILE *f, string &buf) {
+    if (f && !buf.empty()) fwrite(buf.data(), 1, buf.size(), f);
+    buf.clear();
+}
+
+}  // namespace
+
+bool parse_log_level(const string &name, LogLevel &level) {
+    if (name == "quiet") level = LogLevel::Quiet;
+    else if (name == "info") level = LogLevel::Info;
+    else if (name == "debug") level = LogLevel::Debug;
+    else return false;
+    return true;
+}
+
+EventQueue::EventQueue(size_t capacity_pow2)
+    : slots(new OutputEvent[capacity_pow2]), mask(capacity_pow2 - 1) {}
+
+bool EventQueue::try_push(OutputEvent &&ev) {
+    size_t h = head.load(memory_order_relaxed);
+    if (h - tail.load(memory_order_acquire) > mask) return false;
+    slots[h & mask] = move(ev);
+    head.store(h + 1, memory_order_release);
+    return true;
+}
+
+bool EventQueue::try_pop(OutputEvent &ev) {
+    size_t t = tail.load(memory_order_relaxed);
+    if (t == head.load(memory_order_acquire)) return false;
+    ev = move(slots[t & mask]);
+    tail.store(t + 1, memory_order_release);
+    return true;
+}
+
+ResultWriter::ResultWriter(const OutputConfig &cfg) : config(cfg), queue(QUEUE_CAPACITY) {
+    if (!config.json_path.empty()) {
+        json = fopen(config.json_path.c_str(), "w");
+        if (!json) cerr << "Aviso: nao foi possivel abrir " << config.json_path << '\n';
+        else json_buf += "[\n";
+    }
+    if (!config.csv_path.empty()) {
+        csv = fopen(config.csv_path.c_str(), "w");
+        if (!csv) cerr << "Aviso: nao foi possivel abrir " << config.csv_path << '\n';
+        else csv_buf += "instance,time,iterations,bins,waste,initial_bins,initial_waste,fixed_bins,initial_heuristic\n";
+    }
+    worker = thread(&ResultWriter::run, this);
+}
+
+ResultWriter::~ResultWriter() {
+    close();
+}
+
+void ResultWriter::start(int instance, int bins, double waste) {
+    OutputEvent ev;
+    ev.kind = OutputEvent::Start;
+    ev.instance = instance;
+    ev.bins = bins;
+    ev.waste = waste;
+    while (!queue.try_push(move(ev))) this_thread::yield();
+}
+
+void ResultWriter::improvement(int instance, int iterations, int bins, double time) {
+    if (!enabled(LogLevel::Info)) return;
+    OutputEvent ev;
+    ev.kind = OutputEvent::Improvement;
+    ev.instance = instance;
+    ev.iterations = iterations;
+    ev.bins = bins;
+    ev.time = time;
+    if (!queue.try_push(move(ev))) dropped_events.fetch_add(1, memory_order_relaxed);
+}
+
+void ResultWriter::result(OutputEvent &&ev) {
+    ev.kind = OutputEvent::Result;
+    while (!queue.try_push(move(ev))) this_thread::yield();
+}
+
+void ResultWriter::message(LogLevel level, string text) {
+    if (!enabled(level)) return;
+    OutputEvent ev;
+    ev.kind = OutputEvent::Message;
+    ev.level = level;
+    ev.text = move(text);
+    if (!queue.try_push(move(ev))) dropped_events.fetch_add(1, memory_order_relaxed);
+}
+
+void ResultWriter::close() {
+    if (!worker.joinable()) return;
+    done.store(true, memory_order_release);
+    worker.join();
+
+    if (json) {
+        json_buf += json_first ? "]\n" : "\n]\n";
+        write_file(json, json_buf);
+        fclose(json);
+        json = nullptr;
+    }
+    if (csv) {
+        write_file(csv, csv_buf);
+        fclose(csv);
+        csv = nullptr;
+    }
+    size_t lost = dropped();
+    if (lost > 0) cerr << "Aviso: " << lost << " eventos de log descartados (fila cheia)\n";
+}
+
+void ResultWriter::run() {
+    OutputEvent ev;
+    int idle = 0;
+    while (true) {
+        if (queue.try_pop(ev)) {
+            write_event(ev);
+            idle = 0;
+            if (console_buf.size() > FLUSH_THRESHOLD) flush_buffers();
+            continue;
+        }
+        // Fila vazia: escreve o que estiver pendente e so entao verifica o termino,
+        // garantindo que nenhum evento enfileirado antes de close() seja perdido.
+        flush_buffers();
+        if (done.load(memory_order_acquire)) {
+            if (queue.try_pop(ev)) {
+                write_event(ev);
+                continue;
+            }
+            break;
+        }
+        if (++idle < 64) this_thread::yield();
+        else this_thread::sleep_for(chrono::milliseconds(1));
+    }
+    flush_buffers();
+}
+
+void ResultWriter::flush_buffers() {
+    if (!console_buf.empty()) {
+        cout.write(console_buf.data(), console_buf.size());
+        cout.flush();
+        console_buf.clear();
+    }
+    write_file(json, json_buf);
+    write_file(csv, csv_buf);
+}
+
+void ResultWriter::write_event(const OutputEvent &ev) {
+    string &out = console_buf;
+    switch (ev.kind) {
+    case OutputEvent::Start:
+        if (enabled(LogLevel::Info)) {
+            out += "Instancia ";
+            append_int(out, ev.instance);
+            out += "\n   -> Solucao Inicial: Bins=";
+            append_int(out, ev.bins);
+            out += ", Waste=";
+            append_fixed(out, ev.waste, 2);
+            out += '\n';
+        }
+        break;
+
+    case OutputEvent::Improvement:
+        if (enabled(LogLevel::Info)) {
+            out += "   -> Melhoria! Bins: ";
+            append_int(out, ev.bins);
+            out += " (Iter: ";
+            append_int(out, ev.iterations);
+            out += ")\n";
+        }
+        break;
+
+    case OutputEvent::Message:
+        out += ev.text;
+        out += '\n';
+        break;
+
+    case OutputEvent::Result:
+        out += "Instancia ";
+        append_int(out, ev.instance);
+        out += ": Tempo=";
+        append_fixed(out, ev.time, 2);
+        out += "s, Iter=";
+        append_int(out, ev.iterations);
+        out += ", Bins=";
+        append_int(out, ev.bins);
+        out += ", Waste=";
+        append_fixed(out, ev.waste, 2);
+        out += '\n';
+
+        if (config.show_solution) {
+            for (size_t i = 0; i < ev.solution.size(); ++i) {
+                const auto &bin = ev.solution[i];
+                out += "  Bin ";
+                append_padded(out, i + 1, 3);
+                out += " (";
+                append_fixed(out, accumulate(bin.begin(), bin.end(), 0.0), 2);
+                out += '/';
+                append_fixed(out, ev.capacity, 2);
+                out += "): ";
+                for (double item : bin) {
+                    append_fixed(out, item, 2);
+                    out += ' ';
+                }
+                out += '\n';
+            }
+        }
+        out += "---------------------------------------------------\n";
+
+        if (json) {
+            json_buf += json_first ? "  {" : ",\n  {";
+            json_first = false;
+            json_buf += "\"instance\": ";
+            append_int(json_buf, ev.instance);
+            json_buf += ", \"time\": ";
+            append_fixed(json_buf, ev.time, 6);
+            json_buf += ", \"iterations\": ";
+            append_int(json_buf, ev.iterations);
+            json_buf += ", \"bins\": ";
+            append_int(json_buf, ev.bins);
+            json_buf += ", \"waste\": ";
+            append_fixed(json_buf, ev.waste, 6);
+            json_buf += ", \"initial_bins\": ";
+            append_int(json_buf, ev.initial_bins);
+            json_buf += ", \"initial_waste\": ";
+            append_fixed(json_buf, ev.initial_waste, 6);
+            json_buf += ", \"capacity\": ";
+            append_shortest(json_buf, ev.capacity);
+            json_buf += ", \"fixed_bins\": ";
+            append_int(json_buf, ev.fixed_bins);
+            json_buf += ", \"initial_heuristic\": \"";
+            json_buf += ev.initial_heuristic;
+            json_buf += '"';
+            json_buf += ", \"solution\": [";
+            for (size_t i = 0; i < ev.solution.size(); ++i) {
+                json_buf += i ? ", [" : "[";
+                for (size_t j = 0; j < ev.solution[i].size(); ++j) {
+                    if (j) json_buf += ", ";
+                    append_shortest(json_buf, ev.solution[i][j]);
+                }
+                json_buf += ']';
+            }
+            json_buf += "]}";
+        }
+        if (csv) {
+            append_int(csv_buf, ev.instance);
+            csv_buf += ',';
+            append_fixed(csv_buf, ev.time, 6);
+            csv_buf += ',';
+            append_int(csv_buf, ev.iterations);
+            csv_buf += ',';
+            append_int(csv_buf, ev.bins);
+            csv_buf += ',';
+            append_fixed(csv_buf, ev.waste, 6);
+            csv_buf += ',';
+            append_int(csv_buf, ev.initial_bins);
+            csv_buf += ',';
+            append_fixed(csv_buf, ev.initial_waste, 6);
+            csv_buf += ',';
+            append_int(csv_buf, ev.fixed_bins);
+            csv_buf += ',';
+            csv_buf += ev.initial_heuristic;
+            csv_buf += '\n';
+        }
+        break;
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * Subsistema de saida estruturada do BinPacking.
+ *
+ * - A thread de busca apenas enfileira eventos ("OutputEvent") numa fila circular
+ *   lock-free de produtor unico / consumidor unico (SPSC).
+ * - Uma thread de fundo consome a fila, formata e escreve no console (conforme o
+ *   nivel de log) e, opcionalmente, em arquivos de resultado JSON e CSV.
+ * - Eventos de melhoria sao descartados quando a fila esta cheia (a busca nunca
+ *   espera por I/O); eventos de resultado nunca sao descartados.
+ */
+#ifndef OUTPUT_HPP
+#define OUTPUT_HPP
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+enum class LogLevel {
+    Quiet = 0,  // Apenas o resumo final de cada instancia
+    Info = 1,   // Solucao inicial, melhorias e resumo (padrao)
+    Debug = 2,  // Informacoes adicionais da busca
+};
+
+bool parse_log_level(const std::string &name, LogLevel &level);
+
+struct OutputEvent {
+    enum Kind { Start, Improvement, Result, Message };
+
+    Kind kind = Message;
+    LogLevel level = LogLevel::Info;
+    int instance = 0;
+    int iterations = 0;
+    int bins = 0;
+    double waste = 0.0;
+    double time = 0.0;
+    double capacity = 0.0;
+    int initial_bins = 0;
+    double initial_waste = 0.0;
+    int fixed_bins = 0;                          // Bins fixados pela reducao (inicio de "solution")
+    std::string initial_heuristic;               // Heuristica construtiva da solucao inicial
+    std::vector<std::vector<double>> solution;  // Somente em Result
+    std::string text;                            // Somente em Message
+};
+
+// Fila circular SPSC de capacidade fixa (potencia de 2).
+class EventQueue {
+public:
+    explicit EventQueue(size_t capacity_pow2);
+
+    bool try_push(OutputEvent &&ev);
+    bool try_pop(OutputEvent &ev);
+
+private:
+    std::unique_ptr<OutputEvent[]> slots;
+    size_t mask;
+    alignas(64) std::atomic<size_t> head{0};  // Escrito pelo produtor
+    alignas(64) std::atomic<size_t> tail{0};  // Escrito pelo consumidor
+};
+
+struct OutputConfig {
+    LogLevel level = LogLevel::Info;
+    bool show_solution = false;
+    std::string json_path;
+    std::string csv_path;
+};
+
+class ResultWriter {
+public:
+    explicit ResultWriter(const OutputConfig &config);
+    ~ResultWriter();
+
+    ResultWriter(const ResultWriter &) = delete;
+    ResultWriter &operator=(const ResultWriter &) = delete;
+
+    // Chamados pela thread de busca; nunca fazem I/O.
+    void start(int instance, int bins, double waste);
+    void improvement(int instance, int iterations, int bins, double time);
+    void result(OutputEvent &&ev);
+    void message(LogLevel level, std::string text);
+
+    bool enabled(LogLevel level) const { return level <= config.level; }
+
+    // Esvazia a fila, fecha os arquivos e encerra a thread de escrita.
+    void close();
+
+    size_t dropped() const { return dropped_events.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+    void write_event(const OutputEvent &ev);
+    void flush_buffers();
+
+    OutputConfig config;
+    EventQueue queue;
+    std::atomic<bool> done{false};
+    std::atomic<size_t> dropped_events{0};
+    std::thread worker;
+
+    std::FILE *json = nullptr;
+    std::FILE *csv = nullptr;
+    bool json_first = true;
+    std::string console_buf;
+    std::string json_buf;
+    std::string csv_buf;
+};
+
+#endif
@@ -0,0 +1,169 @@
+// Perturbação do ILS: família de operadores ruin-and-recreate.
+//
+// Ruína (remove cerca de p itens):
+// - RandomItems: itens sorteados por amostragem com rejeição (bin uniforme, aceito com
+//   probabilidade itens/limite, onde o limite é o maior número de itens por bin já
+//   observado), sem listar nem embaralhar todos os itens.
+// - EmptiestBins: esvazia os bins de maior folga até remover p itens.
+// - RelatedItems: sorteia um item semente e remove, dentre 3p itens amostrados, os p de
+//   tamanho mais próximo ao da semente.
+// Recriação: reinsere as cópias removidas por Best Fit em blocos, em ordem aleatória de
+// classe ou em ordem decrescente de tamanho.
+// Cada item removido ou reinserido custa O(log bins) pelo índice de folgas da solução,
+// então o operador custa O(p log bins) em vez de O(n).
+#ifndef PERTURBATION_HPP
+#define PERTURBATION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "solution.hpp"
+
+namespace bp {
+
+enum class RuinKind { RandomItems, EmptiestBins, RelatedItems };
+enum class RecreateOrder { Random, DecreasingSize };
+
+template <typename Size>
+class RuinRecreate {
+public:
+    RuinRecreate() = default;
+
+    explicit RuinRecreate(const Classes<Size> &classes) : removed(classes.size(), 0) {}
+
+    template <typename Rng>
+    void apply(Solution<Size> &sol, const Classes<Size> &classes, Rng &rng, int p, RuinKind ruin,
+               RecreateOrder order) {
+        if (sol.empty() || p <= 0) return;
+        removed_classes.clear();
+        emptied.clear();
+
+        switch (ruin) {
+        case RuinKind::RandomItems: ruin_random(sol, classes, rng, p); break;
+        case RuinKind::EmptiestBins: ruin_emptiest(sol, classes, p); break;
+        case RuinKind::RelatedItems: ruin_related(sol, classes, rng, p); break;
+        }
+
+        // Fecha os bins esvaziados do maior para o menor índice: ao trocar com o último,
+        // o bin movido nunca é um dos que ainda serão fechados
+        std::sort(emptied.begin(), emptied.end(), std::greater<int>());
+        for (int b : emptied) sol.close_bin(b);
+
+        if (order == RecreateOrder::Random) {
+            std::shuffle(removed_classes.begin(), removed_classes.end(), rng);
+        }
+        else {
+            std::sort(removed_classes.begin(), removed_classes.end()); // Classes já em ordem decrescente
+        }
+        for (int cls : removed_classes) {
+            best_fit_insert(sol, cls, removed[cls], classes, sol.capacity());
+            removed[cls] = 0;
+        }
+    }
+
+private:
+    static const int MAX_TRIES = 1 << 10;
+
+    // Limite de itens por bin da amostragem com rejeição: o maior valor já observado, em
+    // vez do pior caso C/menor item, que tornaria a rejeição muito frequente
+    int bound = 1;
+    std::vector<int> removed;         // Cópias removidas por classe
+    std::vector<int> removed_classes; // Classes com cópias removidas
+    std::vector<int> emptied;         // Bins esvaziados pela ruína
+    std::vector<std::tuple<double, int, int>> candidates; // (distância, bin, classe)
+
+    void take(Solution<Size> &sol, int b, size_t entry, int count, const Classes<Size> &classes) {
+        int cls = sol[b].entries[entry].cls;
+        if (removed[cls] == 0) removed_classes.push_back(cls);
+        removed[cls] += count;
+        sol.remove(b, entry, count, classes);
+        if (sol[b].items == 0) emptied.push_back(b);
+    }
+
+    // Sorteia um item uniformemente: bin uniforme aceito com probabilidade itens/limite
+    template <typename Rng>
+    bool sample_item(const Solution<Size> &sol, Rng &rng, int &bin, size_t &entry) {
+        std::uniform_int_distribution<int> pick_bin(0, sol.size() - 1);
+        std::uniform_int_distribution<int> pick_slot(0, bound - 1);
+        for (int tries = 0; tries < MAX_TRIES; ++tries) {
+            int b = pick_bin(rng);
+            if (sol[b].items > bound) {
+                bound = sol[b].items;
+                pick_slot = std::uniform_int_distribution<int>(0, bound - 1);
+            }
+            int u = pick_slot(rng);
+            if (u >= sol[b].items) continue;
+            const auto &entries = sol[b].entries;
+            for (size_t e = 0; e < entries.size(); ++e) {
+                if (u < entries[e].count) {
+                    bin = b;
+                    entry = e;
+                    return true;
+                }
+                u -= entries[e].count;
+            }
+        }
+        return false;
+    }
+
+    template <typename Rng>
+    void ruin_random(Solution<Size> &sol, const Classes<Size> &classes, Rng &rng, int p) {
+        int b;
+        size_t e;
+        for (int k = 0; k < p && sample_item(sol, rng, b, e); ++k) {
+            take(sol, b, e, 1, classes);
+        }
+    }
+
+    void ruin_emptiest(Solution<Size> &sol, const Classes<Size> &classes, int p) {
+        int taken = 0;
+        while (taken < p && !sol.empty()) {
+            int b = std::prev(sol.by_slack().end())->second;
+            while (!sol[b].entries.empty()) {
+                Entry entry = sol[b].entries.back();
+                taken += entry.count;
+                int cls = entry.cls;
+                if (removed[cls] == 0) removed_classes.push_back(cls);
+                removed[cls] += entry.count;
+                sol.remove(b, sol[b].entries.size() - 1, entry.count, classes);
+            }
+            sol.close_bin(b);
+        }
+    }
+
+    template <typename Rng>
+    void ruin_related(Solution<Size> &sol, const Classes<Size> &classes, Rng &rng, int p) {
+        int b;
+        size_t e;
+        if (!sample_item(sol, rng, b, e)) return;
+        double seed = (double)classes[sol[b].entries[e].cls].size;
+
+        candidates.clear();
+        for (int k = 0; k < 3 * p && sample_item(sol, rng, b, e); ++k) {
+            int cls = sol[b].entries[e].cls;
+            candidates.emplace_back(std::fabs((double)classes[cls].size - seed), b, cls);
+        }
+        size_t keep = std::min(candidates.size(), (size_t)p);
+        std::nth_element(candidates.begin(), candidates.begin() + keep, candidates.end());
+
+        // Itens amostrados mais de uma vez são retirados apenas enquanto houver cópias
+        for (size_t k = 0; k < keep; ++k) {
+            int bin = std::get<1>(candidates[k]);
+            int cls = std::get<2>(candidates[k]);
+            const auto &entries = sol[bin].entries;
+            for (size_t entry = 0; entry < entries.size(); ++entry) {
+                if (entries[entry].cls == cls) {
+                    take(sol, bin, entry, 1, classes);
+                    break;
+                }
+            }
+        }
+    }
+};
+
+}  // namespace bp
+
+#endif
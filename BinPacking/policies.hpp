@@ -0,0 +1,94 @@
+// Políticas de compilação do Solver: vizinhança da busca local e critério de aceitação.
+//
+// Uma vizinhança expõe "bool improve(Solution&, const Classes&, Size capacity)", que aplica
+// um movimento de melhoria e retorna false quando a solução é um ótimo local.
+// Um critério de aceitação expõe "bool accept(const Fit &candidate, const Fit &current)".
+// Por serem parâmetros de template, a combinação escolhida é resolvida em tempo de
+// compilação e o laço principal não tem chamadas virtuais.
+#ifndef POLICIES_HPP
+#define POLICIES_HPP
+
+#include <utility>
+#include <vector>
+
+#include "solution.hpp"
+
+namespace bp {
+
+// Esvazia um bin que contém apenas uma classe (k cópias): primeiro tenta mover as k cópias
+// de uma vez para o bin mais justo onde todas cabem; senão, distribui as cópias em blocos
+// de Best Fit entre vários bins. Para na primeira melhoria encontrada.
+// Os destinos são obtidos do índice de folgas da solução em O(log bins).
+struct SingleClassRelocation {
+    // Blocos já movidos ao tentar distribuir as cópias: (bin, cópias)
+    std::vector<std::pair<int, int>> moved;
+
+    template <typename Size>
+    bool improve(Solution<Size> &current, const Classes<Size> &classes, Size capacity) {
+        for (size_t i = 0; i < current.size(); ++i) {
+            if (current[i].entries.size() != 1) continue;
+
+            int cls = current[i].entries[0].cls;
+            int k = current[i].entries[0].count;
+            Size size = classes[cls].size;
+
+            // 1. As k cópias de uma vez no bin mais justo onde todas cabem
+            int best_j = current.tightest_fit(k * size, i);
+            if (best_j != -1) {
+                current.add(best_j, cls, k, classes);
+            }
+            // 2. Distribui as cópias entre vários bins, em blocos de Best Fit
+            else if (k == 1 || !spread(current, i, cls, k, classes, capacity)) {
+                continue;
+            }
+
+            current.remove(i, 0, k, classes);
+            current.close_bin(i);
+            return true;
+        }
+        return false;
+    }
+
+private:
+    // Move as cópias em blocos; se alguma não couber, desfaz os blocos já movidos
+    template <typename Size>
+    bool spread(Solution<Size> &current, int src, int cls, int k, const Classes<Size> &classes, Size capacity) {
+        Size size = classes[cls].size;
+        moved.clear();
+        int left = k;
+        while (left > 0) {
+            int j = current.tightest_fit(size, src);
+            if (j == -1) break;
+            int copies = std::min(left, copies_that_fit(current[j].load, size, capacity));
+            current.add(j, cls, copies, classes);
+            moved.push_back({j, copies});
+            left -= copies;
+        }
+        if (left == 0) return true;
+
+        for (const auto &mv : moved) {
+            const auto &entries = current[mv.first].entries;
+            for (size_t e = 0; e < entries.size(); ++e) {
+                if (entries[e].cls == cls) {
+                    current.remove(mv.first, e, mv.second, classes);
+                    break;
+                }
+            }
+        }
+        return false;
+    }
+};
+
+// Aceita sempre a solução vizinha (passeio aleatório; comportamento original do ILS)
+struct AcceptAll {
+    bool accept(const Fit &, const Fit &) const { return true; }
+};
+
+// Aceita a solução vizinha apenas se ela não for pior que a atual
+struct AcceptNotWorse {
+    bool accept(const Fit &candidate, const Fit &current) const { return !(current < candidate); }
+};
+
+}  // namespace bp
+
+#endif
@@ -0,0 +1,95 @@
+// Pré-processamento: regras de redução de Martello-Toth.
+#ifndef REDUCTION_HPP
+#define REDUCTION_HPP
+
+#include <cmath>
+#include <iterator>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "instance.hpp"
+
+namespace bp {
+
+enum ReductionRule { RULE_ISOLATED, RULE_EXACT_PAIR, RULE_DOMINANT_PAIR, NUM_RULES };
+
+struct ReductionStats {
+    int items_removed[NUM_RULES] = {0, 0, 0};
+    int bins_fixed[NUM_RULES] = {0, 0, 0};
+};
+
+// Resultado do pré-processamento: bins fixados e itens que seguem para a busca
+template <typename Size>
+struct Reduction {
+    PlainSolution<Size> fixed_bins;
+    std::vector<Size> remaining;
+    ReductionStats stats;
+};
+
+// R1 (isolado): o item não cabe junto com nenhum outro -> bin só com ele.
+// R2 (par exato): dois itens que enchem exatamente o bin -> bin com o par.
+// R3 (par dominante): o item não cabe junto com os dois menores itens restantes,
+//    logo divide o bin com no máximo um item -> par com o maior item que cabe.
+template <typename Size>
+Reduction<Size> reduce_instance(const std::vector<Size> &items, Size capacity) {
+    const Size EPS = ItemTraits<Size>::eps;
+    Reduction<Size> red;
+    std::multiset<Size> alive(items.begin(), items.end());
+
+    auto fix = [&](ReductionRule rule, PlainBin<Size> bin) {
+        red.stats.items_removed[rule] += bin.size();
+        red.stats.bins_fixed[rule]++;
+        red.fixed_bins.push_back(std::move(bin));
+    };
+
+    bool changed = true;
+    while (changed && !alive.empty()) {
+        changed = false;
+        // Percorre do maior para o menor; remover itens só aumenta os menores restantes,
+        // então um item mantido pode se tornar redutível na próxima passada.
+        std::vector<Size> order(alive.rbegin(), alive.rend());
+        for (Size item : order) {
+            auto self = alive.find(item);
+            if (self == alive.end()) continue; // Já removido como parceiro nesta passada
+            alive.erase(self);
+
+            if (alive.empty() || item + *alive.begin() > capacity + EPS) {
+                fix(RULE_ISOLATED, PlainBin<Size>{item});
+                changed = true;
+                continue;
+            }
+
+            auto partner = std::prev(alive.upper_bound(capacity - item + EPS));
+            Size second_smallest = alive.size() > 1 ? *std::next(alive.begin()) : capacity;
+            if (std::fabs((double)(item + *partner - capacity)) <= (double)EPS) {
+                fix(RULE_EXACT_PAIR, PlainBin<Size>{item, *partner});
+                alive.erase(partner);
+                changed = true;
+            }
+            else if (alive.size() == 1 || item + *alive.begin() + second_smallest > capacity + EPS) {
+                fix(RULE_DOMINANT_PAIR, PlainBin<Size>{item, *partner});
+                alive.erase(partner);
+                changed = true;
+            }
+            else {
+                alive.insert(item);
+            }
+        }
+    }
+
+    // Mantém a ordem original dos itens restantes
+    red.remaining.reserve(alive.size());
+    for (Size item : items) {
+        auto it = alive.find(item);
+        if (it != alive.end()) {
+            red.remaining.push_back(item);
+            alive.erase(it);
+        }
+    }
+    return red;
+}
+
+}  // namespace bp
+
+#endif
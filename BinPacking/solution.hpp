@@ -0,0 +1,293 @@
+// Representação da solução, avaliação e heurística construtiva (Best Fit Decreasing).
+#ifndef SOLUTION_HPP
+#define SOLUTION_HPP
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "instance.hpp"
+
+namespace bp {
+
+// first: número de bins (objetivo primário); second: desperdício total (secundário)
+using Fit = std::pair<int, double>;
+
+// Cópias de uma classe dentro de um bin
+struct Entry {
+    int cls;
+    int count;
+};
+
+template <typename Size>
+struct Bin {
+    std::vector<Entry> entries;
+    Size load = 0;
+    int items = 0;
+};
+
+// Solução: bins densos (sem bins vazios entre operações) e um índice dos bins ordenado
+// pela folga, que permite achar o bin mais justo para um item em O(log bins).
+// Os bins só são alterados pelos métodos abaixo, que mantêm o índice consistente.
+//
+// Registro de desfazer: entre "begin_log" e "commit"/"rollback", cada alteração é anotada
+// num registro; "rollback" desfaz as alterações em ordem inversa, o que permite ao ILS
+// trabalhar numa única solução em vez de copiá-la a cada iteração.
+template <typename Size>
+class Solution {
+public:
+    using Slack = std::pair<Size, int>; // (folga, bin)
+
+    Solution() = default;
+    explicit Solution(Size capacity) : cap(capacity) {}
+
+    // Cópias levam apenas o estado, nunca o registro de desfazer
+    Solution(const Solution &other) : cap(other.cap), bins(other.bins), slack(other.slack) {}
+    Solution &operator=(const Solution &other) {
+        cap = other.cap;
+        bins = other.bins;
+        slack = other.slack;
+        journal.clear();
+        logging = false;
+        return *this;
+    }
+    Solution(Solution &&) = default;
+    Solution &operator=(Solution &&) = default;
+
+    Size capacity() const { return cap; }
+    size_t size() const { return bins.size(); }
+    bool empty() const { return bins.empty(); }
+    const Bin<Size> &operator[](size_t b) const { return bins[b]; }
+    typename std::vector<Bin<Size>>::const_iterator begin() const { return bins.begin(); }
+    typename std::vector<Bin<Size>>::const_iterator end() const { return bins.end(); }
+
+    // Índice (folga, bin) em ordem crescente de folga
+    const std::set<Slack> &by_slack() const { return slack; }
+    Size slack_of(int b) const { return cap - bins[b].load; }
+
+    int open_bin() {
+        bins.emplace_back();
+        slack.insert({cap, (int)bins.size() - 1});
+        record(Move::Open, bins.size() - 1, 0, 0, 0);
+        return bins.size() - 1;
+    }
+
+    void add(int b, int cls, int count, const Classes<Size> &classes) {
+        record(Move::Add, b, cls, count, 0);
+        add_copies(b, cls, count, classes);
+    }
+
+    // Retira cópias da entrada "entry_idx"; se a entrada zera, a última entrada do bin
+    // passa a ocupar a sua posição. Bins que ficam vazios continuam abertos até "close_bin".
+    void remove(int b, size_t entry_idx, int count, const Classes<Size> &classes) {
+        record(Move::Remove, b, bins[b].entries[entry_idx].cls, count, 0);
+        remove_copies(b, entry_idx, count, classes);
+    }
+
+    // Fecha um bin vazio trocando-o com o último (apenas o último muda de índice)
+    void close_bin(int b) {
+        int last = bins.size() - 1;
+        record(Move::Close, b, last, 0, bins[b].load);
+        slack.erase({cap - bins[b].load, b});
+        if (b != last) {
+            set_slack(last, b, bins[last].load);
+            bins[b] = std::move(bins[last]);
+        }
+        bins.pop_back();
+    }
+
+    // Fecha todos os bins vazios
+    void close_empty_bins() {
+        for (int b = bins.size() - 1; b >= 0; --b) {
+            if (bins[b].items == 0) close_bin(b);
+        }
+    }
+
+    // Bin com a menor folga que ainda comporta "size" (Best Fit), ignorando "exclude"; -1 se nenhum
+    int tightest_fit(Size size, int exclude = -1) const {
+        auto it = slack.lower_bound({size - ItemTraits<Size>::eps, std::numeric_limits<int>::min()});
+        if (it != slack.end() && it->second == exclude) ++it;
+        return it == slack.end() ? -1 : it->second;
+    }
+
+    void begin_log() {
+        journal.clear();
+        logging = true;
+    }
+
+    void commit() {
+        journal.clear();
+        logging = false;
+    }
+
+    void rollback(const Classes<Size> &classes) {
+        logging = false;
+        for (auto it = journal.rbegin(); it != journal.rend(); ++it) {
+            const Move &mv = *it;
+            switch (mv.kind) {
+            case Move::Add:
+                remove_copies(mv.bin, find_entry(mv.bin, mv.cls), mv.count, classes);
+                break;
+            case Move::Remove:
+                add_copies(mv.bin, mv.cls, mv.count, classes);
+                break;
+            case Move::Open:
+                slack.erase({cap - bins.back().load, mv.bin});
+                bins.pop_back();
+                break;
+            case Move::Close:
+                // mv.cls guarda o índice do último bin no momento do fechamento
+                bins.emplace_back();
+                if (mv.bin != mv.cls) {
+                    set_slack(mv.bin, mv.cls, bins[mv.bin].load);
+                    std::swap(bins[mv.bin], bins[mv.cls]);
+                }
+                bins[mv.bin].load = mv.load;
+                slack.insert({cap - mv.load, mv.bin});
+                break;
+            }
+        }
+        journal.clear();
+    }
+
+private:
+    struct Move {
+        enum Kind : unsigned char { Add, Remove, Open, Close };
+        Kind kind;
+        int bin;
+        int cls;
+        int count;
+        Size load;
+    };
+
+    Size cap = 0;
+    std::vector<Bin<Size>> bins;
+    std::set<Slack> slack;
+    std::vector<Move> journal;
+    bool logging = false;
+
+    void record(typename Move::Kind kind, int bin, int cls, int count, Size load) {
+        if (logging) journal.push_back({kind, bin, cls, count, load});
+    }
+
+    // Atualiza a chave de um bin no índice reaproveitando o nó (sem alocação)
+    void set_slack(int from_bin, int to_bin, Size old_load) {
+        auto node = slack.extract({cap - old_load, from_bin});
+        node.value() = {cap - bins[from_bin].load, to_bin};
+        slack.insert(std::move(node));
+    }
+
+    size_t find_entry(int b, int cls) const {
+        const auto &entries = bins[b].entries;
+        for (size_t e = 0; e < entries.size(); ++e) {
+            if (entries[e].cls == cls) return e;
+        }
+        return entries.size();
+    }
+
+    void add_copies(int b, int cls, int count, const Classes<Size> &classes) {
+        Bin<Size> &bin = bins[b];
+        Size old_load = bin.load;
+        bin.load += count * classes[cls].size;
+        bin.items += count;
+        set_slack(b, b, old_load);
+        for (auto &e : bin.entries) {
+            if (e.cls == cls) {
+                e.count += count;
+                return;
+            }
+        }
+        bin.entries.push_back({cls, count});
+    }
+
+    void remove_copies(int b, size_t entry_idx, int count, const Classes<Size> &classes) {
+        Bin<Size> &bin = bins[b];
+        Entry &e = bin.entries[entry_idx];
+        Size old_load = bin.load;
+        bin.load -= count * classes[e.cls].size;
+        bin.items -= count;
+        set_slack(b, b, old_load);
+        e.count -= count;
+        if (e.count == 0) {
+            e = bin.entries.back();
+            bin.entries.pop_back();
+        }
+    }
+};
+
+// Converte para a lista explícita de itens por bin (usada apenas na saída)
+template <typename Size>
+PlainSolution<Size> expand(const Solution<Size> &bins, const Classes<Size> &classes) {
+    PlainSolution<Size> plain(bins.size());
+    for (size_t i = 0; i < bins.size(); ++i) {
+        plain[i].reserve(bins[i].items);
+        for (const auto &e : bins[i].entries) {
+            plain[i].insert(plain[i].end(), e.count, classes[e.cls].size);
+        }
+    }
+    return plain;
+}
+
+template <typename Size>
+Fit fitness(const PlainSolution<Size> &bins, Size capacity) {
+    double total_waste = 0.0;
+    for (const auto &b : bins) {
+        total_waste += (double)capacity - std::accumulate(b.begin(), b.end(), 0.0);
+    }
+    return {(int)bins.size(), total_waste};
+}
+
+template <typename Size>
+Fit fitness(const Solution<Size> &bins, Size capacity) {
+    double total_waste = 0.0;
+    for (const auto &b : bins) {
+        total_waste += (double)(capacity - b.load);
+    }
+    return {(int)bins.size(), total_waste};
+}
+
+// Quantas cópias de um item de tamanho "size" ainda cabem num bin com carga "load"
+template <typename Size>
+int copies_that_fit(Size load, Size size, Size capacity) {
+    if (size <= 0) return std::numeric_limits<int>::max();
+    return std::max(0, (int)((capacity - load + ItemTraits<Size>::eps) / size));
+}
+
+template <typename Size>
+bool fits(Size load, Size size, Size capacity) {
+    return load + size <= capacity + ItemTraits<Size>::eps;
+}
+
+// Best Fit em blocos: o bin mais justo recebe de uma vez todas as cópias que couberem,
+// o que equivale a inserir as cópias uma a uma (o bin continua sendo o mais justo).
+// Cada bloco custa O(log bins) pelo índice de folgas.
+template <typename Size>
+void best_fit_insert(Solution<Size> &bins, int cls, int count, const Classes<Size> &classes, Size capacity) {
+    Size size = classes[cls].size;
+    while (count > 0) {
+        int best_idx = bins.tightest_fit(size);
+        if (best_idx == -1) {
+            best_idx = bins.open_bin();
+        }
+        int copies = std::min(count, std::max(1, copies_that_fit(bins[best_idx].load, size, capacity)));
+        bins.add(best_idx, cls, copies, classes);
+        count -= copies;
+    }
+}
+
+// Best Fit Decreasing sobre as classes (já ordenadas pelo counting sort)
+template <typename Size>
+Solution<Size> best_fit(const Classes<Size> &classes, Size capacity) {
+    Solution<Size> bins(capacity);
+    for (size_t c = 0; c < classes.size(); ++c) {
+        best_fit_insert(bins, c, classes[c].count, classes, capacity);
+    }
+    return bins;
+}
+
+}  // namespace bp
+
+#endif
@@ -0,0 +1,255 @@
+// Solver ILS configurável por políticas (tipo de item, vizinhança e aceitação).
+#ifndef SOLVER_HPP
+#define SOLVER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <type_traits>
+#include <utility>
+
+#include "adaptive.hpp"
+#include "constructive.hpp"
+#include "instance.hpp"
+#include "perturbation.hpp"
+#include "policies.hpp"
+#include "reduction.hpp"
+#include "solution.hpp"
+
+namespace bp {
+
+struct SolverConfig {
+    double time_limit = 1.0;     // Segundos; usado por solve() sem prazo explícito
+    bool reduce = true;          // Pré-processamento de Martello-Toth
+    double perturb_ratio = 0.05; // Fração dos itens removidos na perturbação
+    RuinKind ruin = RuinKind::RandomItems;
+    bool adaptive = true;        // Força e ruína escolhidas por AdaptivePerturbation
+    bool adaptive_ruin = true;   // Se falso, o controle adaptativo só varia a força de "ruin"
+    RecreateOrder recreate = RecreateOrder::Random;
+    unsigned heuristics = ALL_HEURISTICS; // Portfólio construtivo (máscara de "Heuristic")
+    bool parallel_construction = true;    // Uma thread por heurística do portfólio
+    double construction_share = 0.5;      // Fração do prazo além da qual MBS e SS são descartadas
+    unsigned seed = 0;           // 0: semente de random_device
+    const std::atomic<bool> *stop = nullptr; // Se não nulo, a busca termina quando *stop fica verdadeiro
+};
+
+template <typename Size>
+struct SolverResult {
+    Fit initial_fit{0, 0.0};   // Os totais incluem os bins fixados pela redução
+    Fit best_fit{0, 0.0};
+    int iterations = 0;
+    double time = 0.0;
+    int fixed_bins = 0;
+    int remaining_items = 0;
+    int num_classes = 0;
+    ReductionStats reduction;
+    std::vector<ConstructionRun> construction; // Bins (sem os fixados) e tempo de cada heurística
+    int initial_heuristic = BEST_FIT_DECREASING; // Heurística que gerou a solução inicial
+    PlainSolution<Size> solution; // Bins fixados primeiro, depois os da busca
+};
+
+// Observador padrão: ignora os eventos da busca. on_solution só é chamado para os
+// observadores que declaram "static constexpr bool wants_solutions = true": montar a
+// solução completa a cada melhoria custa O(n) dentro do laço do ILS.
+struct NullListener {
+    template <typename Result>
+    void on_start(const Result &) {}
+    void on_improvement(int, const Fit &, double) {}
+    void on_control(int, const Arm &, int, double) {}
+    template <typename Plain>
+    void on_solution(const Plain &) {}
+};
+
+template <typename Listener, typename = void>
+struct wants_solutions : std::false_type {};
+
+template <typename Listener>
+struct wants_solutions<Listener, std::void_t<decltype(Listener::wants_solutions)>>
+    : std::bool_constant<Listener::wants_solutions> {};
+
+template <typename Listener>
+constexpr bool wants_solutions_v = wants_solutions<std::decay_t<Listener>>::value;
+
+// Aplica movimentos de melhoria na própria solução até o ótimo local ou o tempo acabar
+template <typename Size, typename Neighborhood>
+void local_search(Solution<Size> &current, const Classes<Size> &classes, Size capacity, double time_limit,
+                  Neighborhood &neighborhood) {
+    auto end = Clock::now() + std::chrono::duration<double>(time_limit);
+    while (Clock::now() < end && neighborhood.improve(current, classes, capacity)) {
+    }
+}
+
+template <typename Size, typename Neighborhood = SingleClassRelocation, typename Acceptance = AcceptAll>
+class Solver {
+public:
+    explicit Solver(Instance<Size> instance, SolverConfig cfg = SolverConfig())
+        : inst(std::move(instance)), config(cfg) {}
+
+    SolverResult<Size> solve() {
+        return solve(Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(config.time_limit)));
+    }
+
+    // Executa o ILS até "deadline". O observador recebe on_start(resultado parcial, com a
+    // solução inicial e a redução), on_improvement(iteração, fit total, segundos) e, com o
+    // controle adaptativo, on_control(iteração, braço líder, força, segundos). on_solution
+    // recebe a solução completa (bins fixados + busca) no início e a cada melhoria, se o
+    // observador a pedir (wants_solutions).
+    template <typename Listener = NullListener>
+    SolverResult<Size> solve(Clock::time_point deadline, Listener &&listener = Listener()) {
+        auto start = Clock::now();
+        std::mt19937 rng(config.seed ? config.seed : std::random_device()());
+        SolverResult<Size> result;
+
+        // Pré-processamento: fixa os bins garantidos pelas regras de redução
+        Reduction<Size> red;
+        if (config.reduce) {
+            red = reduce_instance(inst.items, inst.capacity);
+        }
+        else {
+            red.remaining = inst.items;
+        }
+        Fit fixed_fit = fitness(red.fixed_bins, inst.capacity);
+        auto total = [&](const Fit &f) { return Fit{f.first + fixed_fit.first, f.second + fixed_fit.second}; };
+
+        // Itens restantes agrupados em classes (tamanho, quantidade)
+        Classes<Size> classes = compress_items(red.remaining);
+
+        // O desperdício depende só do número de bins (bins * C - soma dos itens), então o
+        // fit de uma solução é obtido em O(1)
+        double total_size = 0.0;
+        for (Size item : red.remaining) total_size += item;
+        auto fit_of = [&](const Solution<Size> &sol) {
+            return Fit{(int)sol.size(), (double)sol.size() * inst.capacity - total_size};
+        };
+
+        // Solução inicial: a melhor do portfólio de heurísticas construtivas, que não pode
+        // consumir o prazo da busca
+        auto now = Clock::now();
+        auto construction_deadline =
+            deadline <= now ? now
+                            : now + std::chrono::duration_cast<Clock::duration>((deadline - now) * config.construction_share);
+        Portfolio<Size> portfolio = run_portfolio(red.remaining, classes, inst.capacity, config.heuristics,
+                                                  config.parallel_construction, construction_deadline);
+        Solution<Size> current_sol = std::move(portfolio.best);
+        Fit current = fit_of(current_sol);
+        Solution<Size> best_sol = current_sol;
+        Fit best = current;
+        RuinRecreate<Size> ruin_recreate(classes);
+
+        int perturb_strength = std::max(1, (int)(red.remaining.size() * config.perturb_ratio));
+        AdaptivePerturbation controller(red.remaining.size(), config.perturb_ratio, config.adaptive_ruin, config.ruin);
+        int logged_leader = -1;
+        auto last_log = start;
+
+        result.initial_fit = total(best);
+        result.reduction = red.stats;
+        result.fixed_bins = red.fixed_bins.size();
+        result.remaining_items = red.remaining.size();
+        result.num_classes = classes.size();
+        result.construction = std::move(portfolio.runs);
+        result.initial_heuristic = portfolio.winner;
+        listener.on_start(result);
+        auto report_solution = [&] {
+            if constexpr (wants_solutions_v<Listener>) {
+                PlainSolution<Size> full = red.fixed_bins;
+                PlainSolution<Size> plain = expand(best_sol, classes);
+                full.insert(full.end(), std::make_move_iterator(plain.begin()), std::make_move_iterator(plain.end()));
+                listener.on_solution(full);
+            }
+        };
+        report_solution();
+
+        // Cada iteração altera "current_sol" no lugar, registrando os movimentos; a iteração
+        // é confirmada ou desfeita conforme o critério de aceitação, e a melhor solução só é
+        // copiada quando melhora.
+        int iterations = 0;
+        while (!red.remaining.empty()) {
+            auto iter_start = Clock::now();
+            double time_left_global = std::chrono::duration<double>(deadline - iter_start).count();
+            if (time_left_global <= 0) break;
+            if (config.stop && config.stop->load(std::memory_order_relaxed)) break;
+
+            double ls_time = std::min({0.1, time_left_global * 0.1, time_left_global - 0.01});
+            if (ls_time <= 0) break;
+            iterations++;
+
+            // Operador da iteração: fixo ou escolhido pelo controle adaptativo
+            int arm = -1;
+            RuinKind ruin = config.ruin;
+            int strength = perturb_strength;
+            std::pair<int, double> before;
+            if (config.adaptive) {
+                arm = controller.choose(rng);
+                ruin = controller.arm(arm).ruin;
+                strength = controller.strength(arm);
+                before = progress_of(current_sol);
+            }
+
+            current_sol.begin_log();
+
+            // '1. Perturbação da solução atual
+            ruin_recreate.apply(current_sol, classes, rng, strength, ruin, config.recreate);
+
+            // '2. Busca local a partir da solução
+            local_search(current_sol, classes, inst.capacity, ls_time, neighborhood);
+
+            // '3. Avaliação da melhor solução vizinha
+            Fit local_opt_fit = fit_of(current_sol);
+            bool improved = local_opt_fit < best;
+
+            if (config.adaptive) {
+                auto now = Clock::now();
+                controller.update(arm, progress_gain(before, progress_of(current_sol), inst.capacity),
+                                  std::chrono::duration<double>(now - iter_start).count());
+                // Registra a troca do braço líder, no máximo a cada 0,1 s
+                int leader = controller.leader();
+                if (leader != logged_leader && now - last_log >= std::chrono::milliseconds(100)) {
+                    logged_leader = leader;
+                    last_log = now;
+                    listener.on_control(iterations, controller.arm(leader), controller.strength(leader),
+                                        std::chrono::duration<double>(now - start).count());
+                }
+            }
+
+            // '4. Aceitação da solução: confirma ou desfaz os movimentos da iteração
+            if (acceptance.accept(local_opt_fit, current)) {
+                current_sol.commit();
+                current = local_opt_fit;
+                if (improved) best_sol = current_sol;
+            }
+            else {
+                if (improved) best_sol = current_sol;
+                current_sol.rollback(classes);
+            }
+
+            if (improved) {
+                best = local_opt_fit;
+                listener.on_improvement(iterations, total(best),
+                                        std::chrono::duration<double>(Clock::now() - start).count());
+                report_solution();
+            }
+        }
+
+        result.iterations = iterations;
+        result.best_fit = total(best);
+        result.time = std::chrono::duration<double>(Clock::now() - start).count();
+        result.solution = std::move(red.fixed_bins);
+        PlainSolution<Size> plain = expand(best_sol, classes);
+        result.solution.insert(result.solution.end(), std::make_move_iterator(plain.begin()),
+                               std::make_move_iterator(plain.end()));
+        return result;
+    }
+
+    const Instance<Size> &instance() const { return inst; }
+
+private:
+    Instance<Size> inst;
+    SolverConfig config;
+    Neighborhood neighborhood;
+    Acceptance acceptance;
+};
+
+}  // namespace bp
+
+#endif
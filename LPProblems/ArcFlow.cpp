@@ -0,0 +1,144 @@
+#include "ArcFlow.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+
+using namespace std;
+
+namespace {
+
+// Acima disso o modelo não cabe num MIP razoável
+const size_t MAX_ARCOS = 10000000;
+
+}  // namespace
+
+ArcFlowGraph::ArcFlowGraph(const BinPackingData &d) : capacidade(d.capacidade), saida(d.capacidade + 1) {
+    // Classes (tamanho, quantidade) em ordem decrescente de tamanho
+    vector<int> tamanhos = d.tamanho;
+    sort(tamanhos.begin(), tamanhos.end(), greater<int>());
+    for (int t : tamanhos) {
+        if (tamanhoClasse.empty() || tamanhoClasse.back() != t) {
+            tamanhoClasse.push_back(t);
+            qtdClasse.push_back(0);
+        }
+        qtdClasse.back()++;
+    }
+
+    const int C = capacidade;
+    vector<char> alcancado(C + 1, 0), proximo;
+    vector<int> ultimaClasse(C + 1, -1);  // Última classe com arco saindo do nó
+    alcancado[0] = 1;
+    for (int k = 0; k < numClasses(); k++) {
+        const int t = tamanhoClasse[k];
+        proximo = alcancado;
+        for (int no = 0; no + t <= C; no++) {
+            if (!alcancado[no]) continue;
+            // Cadeia de até qtdClasse[k] cópias a partir de um nó das classes maiores
+            for (int j = 0, de = no; j < qtdClasse[k] && de + t <= C; j++, de += t) {
+                if (ultimaClasse[de] != k) {
+                    ultimaClasse[de] = k;
+                    arcos.push_back({de, de + t, k});
+                }
+                proximo[de + t] = 1;
+            }
+        }
+        alcancado.swap(proximo);
+        if (arcos.size() > MAX_ARCOS) {
+            throw runtime_error("fluxo em arcos grande demais (mais de " + to_string(MAX_ARCOS) + " arcos)");
+        }
+    }
+    for (int no = 1; no < C; no++) {
+        if (alcancado[no]) arcos.push_back({no, C, -1});
+    }
+
+    for (size_t a = 0; a < arcos.size(); a++) saida[arcos[a].de].push_back(a);
+    for (int no = 0; no <= C; no++) {
+        if (no == 0 || no == C || alcancado[no]) nos.push_back(no);
+    }
+}
+
+bool ArcFlowGraph::flowOf(const vector<vector<int>> &bins, vector<double> &fluxo) const {
+    fluxo.assign(arcos.size(), 0);
+    vector<int> itens;
+    for (const auto &bin : bins) {
+        if (bin.empty()) continue;
+        itens = bin;
+        sort(itens.begin(), itens.end(), greater<int>());
+        int carga = 0;
+        for (int t : itens) {
+            auto pos = lower_bound(tamanhoClasse.begin(), tamanhoClasse.end(), t, greater<int>());
+            if (pos == tamanhoClasse.end() || *pos != t || carga + t > capacidade) return false;
+            const int k = pos - tamanhoClasse.begin();
+            int arco = -1;
+            for (int a : saida[carga]) {
+                if (arcos[a].classe == k) arco = a;
+            }
+            if (arco < 0) return false;
+            fluxo[arco] += 1;
+            carga += t;
+        }
+        if (carga < capacidade) {
+            int arco = -1;
+            for (int a : saida[carga]) {
+                if (arcos[a].classe < 0) arco = a;
+            }
+            if (arco < 0) return false;
+            fluxo[arco] += 1;
+        }
+    }
+    return true;
+}
+
+vector<vector<int>> ArcFlowGraph::binsOf(const vector<double> &fluxo) const {
+    vector<long long> resto(arcos.size());
+    for (size_t a = 0; a < arcos.size(); a++) resto[a] = max(0LL, llround(fluxo[a]));
+    vector<int> falta = qtdClasse;
+    vector<size_t> proximoArco(capacidade + 1, 0);  // Primeiro arco de saída ainda com fluxo
+    vector<vector<int>> bins;
+    while (true) {
+        // Caminho de 0 até a capacidade pelos arcos com fluxo restante
+        vector<int> bin;
+        int no = 0;
+        while (no < capacidade) {
+            const vector<int> &arcosNo = saida[no];
+            size_t &i = proximoArco[no];
+            while (i < arcosNo.size() && resto[arcosNo[i]] == 0) i++;
+            if (i == arcosNo.size()) break;
+            const ArcFlowArc &arco = arcos[arcosNo[i]];
+            resto[arcosNo[i]]--;
+            if (arco.classe >= 0 && falta[arco.classe] > 0) {
+                falta[arco.classe]--;
+                bin.push_back(tamanhoClasse[arco.classe]);
+            }
+            no = arco.para;
+        }
+        if (no == 0) break;
+        if (!bin.empty()) bins.push_back(move(bin));
+    }
+    return bins;
+}
+
+bool checkBinPacking(const BinPackingData &d, const vector<vector<int>> &bins, string &erro) {
+    vector<int> usados;
+    for (size_t b = 0; b < bins.size(); b++) {
+        long long carga = 0;
+        for (int t : bins[b]) {
+            carga += t;
+            usados.push_back(t);
+        }
+        if (carga > d.capacidade) {
+            erro = "bin " + to_string(b + 1) + " excede a capacidade";
+            return false;
+        }
+    }
+    vector<int> itens = d.tamanho;
+    sort(itens.begin(), itens.end());
+    sort(usados.begin(), usados.end());
+    if (itens != usados) {
+        erro = "os bins não usam exatamente os itens da instância";
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,51 @@
+// LPProblems/ArcFlow.hpp
+// Grafo do modelo de fluxo em arcos (Valério de Carvalho) do BinPackingProblem (sem CPLEX).
+//
+// Os nós 0..capacidade são cargas parciais de um bin; cada classe de item (tamanho,
+// quantidade) dá arcos (d, d + tamanho) e os arcos de perda (d, capacidade) fecham o bin.
+// Um bin é um caminho de 0 até a capacidade, e o número de bins é o fluxo que sai de 0.
+// Contra a simetria, as classes entram em ordem decrescente de tamanho: os arcos de uma
+// classe só partem dos nós alcançados pelas classes maiores, seguidos de até "quantidade"
+// cópias dela. Um bin com os itens em ordem decrescente é sempre um caminho do grafo, o
+// que converte qualquer solução (por exemplo, a do ILS do BinPacking) em fluxo nos arcos.
+#ifndef ARC_FLOW_HPP
+#define ARC_FLOW_HPP
+#include <string>
+#include <vector>
+#include "Instances.hpp"
+
+struct ArcFlowArc {
+    int de, para;
+    int classe;  // -1: arco de perda
+};
+
+class ArcFlowGraph {
+public:
+    explicit ArcFlowGraph(const BinPackingData &d);
+
+    const std::vector<ArcFlowArc> &arcs() const { return arcos; }
+    const std::vector<int> &nodes() const { return nos; }  // Nós com arcos, em ordem crescente
+    int numClasses() const { return (int)tamanhoClasse.size(); }
+    int size(int classe) const { return tamanhoClasse[classe]; }
+    int count(int classe) const { return qtdClasse[classe]; }
+
+    // Fluxo em cada arco da solução "bins" (tamanhos dos itens de cada bin); false se
+    // algum bin excede a capacidade ou usa um tamanho que não é da instância
+    bool flowOf(const std::vector<std::vector<int>> &bins, std::vector<double> &fluxo) const;
+
+    // Bins de um fluxo inteiro, por decomposição em caminhos; cópias além da quantidade
+    // de cada classe são descartadas
+    std::vector<std::vector<int>> binsOf(const std::vector<double> &fluxo) const;
+
+private:
+    int capacidade;
+    std::vector<int> tamanhoClasse, qtdClasse;  // Classes em ordem decrescente de tamanho
+    std::vector<ArcFlowArc> arcos;
+    std::vector<int> nos;
+    std::vector<std::vector<int>> saida;  // Arcos que saem de cada nó
+};
+
+// Confere que os bins usam exatamente os itens da instância e respeitam a capacidade
+bool checkBinPacking(const BinPackingData &d, const std::vector<std::vector<int>> &bins, std::string &erro);
+
+#endif
@@ -0,0 +1,338 @@
+#include <ilcplex/ilocplex.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "Problems.hpp"
+#include "ArcFlow.hpp"
+#include "ModelBuilder.hpp"
+#include "../BinPacking/bin_packing.hpp"
+ILOSTLBEGIN
+
+// Bin packing pelo modelo de fluxo em arcos (ArcFlow.hpp), com soluções do ILS do
+// BinPacking (biblioteca header-only) como ponto de partida do CPLEX:
+// - "cplex": só o modelo;
+// - "mipstart": o ILS roda antes por um tempo curto e sua melhor solução, convertida em
+//   fluxo nos arcos, entra com addMIPStart;
+// - "inject": o ILS roda numa thread durante o branch-and-bound; a solução inicial do
+//   portfólio entra com addMIPStart e cada melhoria é entregue ao CPLEX por um callback
+//   genérico (contexto Relaxation) com postHeuristicSolution. O ILS para quando o CPLEX
+//   termina, e o CPLEX usa um núcleo a menos que o modelo.
+// O tempo do ILS antes do CPLEX entra no tempo de resolução, para que os métodos sejam
+// comparáveis pelo tempo até o ótimo: "solver.out -problem BinPacking -generate <n>
+// -method cplex|mipstart|inject -repeat <k> -format csv" (coluna solve_time).
+
+// Tempo do ILS antes do MIP no método "mipstart"
+static double heuristicTime(const ProblemOptions &opts) {
+    return opts.timeLimit > 0 ? min(1.0, opts.timeLimit / 10) : 1.0;
+}
+
+static bp::Instance<int> binPackingInstance(const BinPackingData &d) {
+    bp::Instance<int> inst;
+    inst.capacity = d.capacidade;
+    inst.n = d.numItens;
+    inst.items = d.tamanho;
+    return inst;
+}
+
+// Melhor solução do ILS já convertida para as variáveis do modelo (bins e fluxo nos arcos)
+struct Incumbents {
+    mutex trava;
+    condition_variable chegou;
+    vector<double> valores;
+    int bins = 0;
+    int versao = 0;
+    bool terminou = false;  // O ILS acabou (a espera pela solução inicial não trava)
+};
+
+// Observador do ILS: converte cada solução nova e a publica em "Incumbents"
+struct IncumbentListener : bp::NullListener {
+    static constexpr bool wants_solutions = true;
+
+    const ArcFlowGraph &grafo;
+    Incumbents &melhores;
+
+    IncumbentListener(const ArcFlowGraph &grafo, Incumbents &melhores) : grafo(grafo), melhores(melhores) {}
+
+    void on_solution(const bp::PlainSolution<int> &bins) {
+        vector<double> fluxo;
+        if (!grafo.flowOf(bins, fluxo)) return;
+        vector<double> valores;
+        valores.reserve(fluxo.size() + 1);
+        valores.push_back(bins.size());
+        valores.insert(valores.end(), fluxo.begin(), fluxo.end());
+        lock_guard<mutex> lock(melhores.trava);
+        melhores.valores.swap(valores);
+        melhores.bins = bins.size();
+        melhores.versao++;
+        melhores.chegou.notify_all();
+    }
+};
+
+// Entrega ao CPLEX as soluções do ILS mais novas que a última entregue
+class IncumbentCallback : public IloCplex::Callback::Function {
+public:
+    IncumbentCallback(IloNumVarArray vars, Incumbents &melhores) : vars(vars), melhores(melhores) {}
+
+    void invoke(const IloCplex::Callback::Context &context) override {
+        if (!context.inRelaxation()) return;
+        vector<double> valores;
+        int bins, versao;
+        {
+            lock_guard<mutex> lock(melhores.trava);
+            if (melhores.versao <= entregue.load()) return;
+            valores = melhores.valores;
+            bins = melhores.bins;
+            versao = melhores.versao;
+        }
+        // Cada versão é entregue por uma única thread
+        int anterior = entregue.load();
+        while (anterior < versao && !entregue.compare_exchange_weak(anterior, versao)) {
+        }
+        if (anterior >= versao || bins >= context.getIncumbentObjective()) return;
+
+        IloNumArray v(context.getEnv(), valores.size());
+        for (size_t k = 0; k < valores.size(); k++) v[k] = valores[k];
+        context.postHeuristicSolution(vars, v, bins, IloCplex::Callback::Context::SolutionStrategy::CheckFeasible);
+        v.end();
+        numEntregas++;
+    }
+
+    atomic<int> numEntregas{0};
+
+private:
+    IloNumVarArray vars;
+    Incumbents &melhores;
+    atomic<int> entregue{0};
+};
+
+// Thread do ILS: ao sair de solveArcFlow, inclusive por exceção, o ILS é parado e a
+// thread é esperada antes de "melhores" e do listener deixarem de existir
+struct ILSThread {
+    atomic<bool> &parar;
+    thread t;
+
+    explicit ILSThread(atomic<bool> &parar) : parar(parar) {}
+    ~ILSThread() { join(); }
+
+    void join() {
+        parar = true;
+        if (t.joinable()) t.join();
+    }
+};
+
+static bool solveArcFlow(IloEnv env, const BinPackingData &d, const ProblemOptions &opts, const string &method,
+                         ProblemResult &result, vector<vector<int>> &bins) {
+    Timer timer;
+    const ArcFlowGraph grafo(d);
+    const vector<ArcFlowArc> &arcos = grafo.arcs();
+    const int ARCOS = arcos.size();
+    const int C = d.capacidade;
+
+    // Criar modelo
+    IloModel model(env);
+    ModelBuilder mb(env, opts);
+
+    // Variáveis de decisão: número de bins e fluxo em cada arco
+    const int z = mb.addVars(1, 0, d.numItens, IloNumVar::Int, [](int) { return std::string("bins"); });
+    const int f = mb.addVars(ARCOS, 0, d.numItens, IloNumVar::Int, [&](int a) {
+        return "f" + std::to_string(arcos[a].de) + "_" + std::to_string(arcos[a].para) +
+               (arcos[a].classe < 0 ? std::string("_perda") : "_" + std::to_string(grafo.size(arcos[a].classe)));
+    });
+    for (int a = 0; a < ARCOS; a++) {
+        if (arcos[a].classe >= 0) mb.setBounds(f + a, 0, grafo.count(arcos[a].classe));
+    }
+
+    // Função objetivo: minimizar o número de bins
+    mb.setObjective(z, 1);
+
+    // Restrições
+    // Conservação: z sai de 0 e chega à capacidade; nos demais nós entra o que sai
+    vector<int> linha(C + 1, -1);
+    for (int no : grafo.nodes()) {
+        linha[no] = mb.addRow(0, 0);
+    }
+    mb.addCoef(linha[0], z, 1);
+    mb.addCoef(linha[C], z, -1);
+    for (int a = 0; a < ARCOS; a++) {
+        mb.addCoef(linha[arcos[a].de], f + a, -1);
+        mb.addCoef(linha[arcos[a].para], f + a, 1);
+    }
+    // Demanda de cada classe de item
+    const int demanda = mb.numRows();
+    for (int k = 0; k < grafo.numClasses(); k++) {
+        mb.addRow(grafo.count(k), IloInfinity);
+    }
+    for (int a = 0; a < ARCOS; a++) {
+        if (arcos[a].classe >= 0) mb.addCoef(demanda + arcos[a].classe, f + a, 1);
+    }
+    mb.extract(model, IloObjective::Minimize);
+    IloCplex cplex(model);
+    result.buildTime = timer.lap();
+
+    // Soluções do ILS
+    Incumbents melhores;
+    IncumbentListener listener(grafo, melhores);
+    bp::SolverConfig config;
+    config.seed = opts.seed ? opts.seed : 1;
+    atomic<bool> parar{false};
+    ILSThread ils(parar);
+    IncumbentCallback callback(mb.vars(), melhores);
+    double heuristica = 0;
+    if (method == "mipstart") {
+        config.time_limit = heuristicTime(opts);
+        bp::Solver<int> solver(binPackingInstance(d), config);
+        solver.solve(bp::Clock::now() + chrono::duration_cast<bp::Clock::duration>(
+                                            chrono::duration<double>(config.time_limit)),
+                     listener);
+    }
+    else if (method == "inject") {
+        // O portfólio sequencial deixa os núcleos para o CPLEX
+        config.parallel_construction = false;
+        config.stop = &parar;
+        auto prazo = bp::Clock::now() + chrono::hours(24);
+        if (opts.timeLimit > 0) {
+            prazo = bp::Clock::now() + chrono::duration_cast<bp::Clock::duration>(chrono::duration<double>(opts.timeLimit));
+        }
+        ils.t = thread([&, prazo] {
+            bp::Solver<int> solver(binPackingInstance(d), config);
+            solver.solve(prazo, listener);
+            lock_guard<mutex> lock(melhores.trava);
+            melhores.terminou = true;
+            melhores.chegou.notify_all();
+        });
+        // Espera a solução inicial do portfólio para o MIP start
+        unique_lock<mutex> lock(melhores.trava);
+        melhores.chegou.wait(lock, [&] { return melhores.versao > 0 || melhores.terminou; });
+    }
+    if (method == "mipstart" || method == "inject") {
+        lock_guard<mutex> lock(melhores.trava);
+        if (melhores.versao > 0) {
+            IloNumArray inicio(env, mb.numVars());
+            for (int k = 0; k < mb.numVars(); k++) inicio[k] = melhores.valores[k];
+            cplex.addMIPStart(mb.vars(), inicio, IloCplex::MIPStartCheckFeas);
+            inicio.end();
+        }
+        heuristica = timer.lap();
+    }
+    if (method == "inject") {
+        cplex.use(&callback, IloCplex::Callback::Context::Id::Relaxation);
+    }
+
+    // No "inject" o ILS ocupa um dos núcleos do modelo
+    ProblemOptions mipOpts = opts;
+    if (method == "inject") {
+        const int nucleos = opts.threads > 0 ? opts.threads : max(1u, thread::hardware_concurrency());
+        mipOpts.threads = max(1, nucleos - 1);
+    }
+    bool ok = solveModel(cplex, mipOpts, result);
+    ils.join();
+    result.solveTime += heuristica;
+    if (!ok) {
+        return false;
+    }
+    if (!opts.quiet && method != "cplex") {
+        cout << "ILS: " << melhores.bins << " bins";
+        if (method == "inject") cout << ", " << callback.numEntregas << " soluções entregues durante o branch-and-bound";
+        cout << " (" << heuristica << " s antes do CPLEX)" << endl;
+    }
+
+    IloNumArray valores(env);
+    cplex.getValues(valores, mb.vars());
+    vector<double> fluxo(ARCOS);
+    for (int a = 0; a < ARCOS; a++) fluxo[a] = valores[f + a];
+    valores.end();
+    bins = grafo.binsOf(fluxo);
+    return true;
+}
+
+static void printBins(const vector<vector<int>> &bins) {
+    cout << "Solução ótima = " << bins.size() << " bins" << endl;
+    for (size_t b = 0; b < bins.size() && (int)b < MAX_DETALHES; b++) {
+        cout << "Bin " << b + 1 << ":";
+        for (int t : bins[b]) cout << " " << t;
+        cout << endl;
+    }
+}
+
+// Métodos (opts.method): "cplex" (padrão), "mipstart", "inject" ou "check", que resolve
+// pelos três, confere os bins e compara os valores
+ProblemResult BinPackingProblem(const ProblemOptions &opts) {
+    ProblemResult result;
+    IloEnv env;
+    try {
+        Timer timer;
+        // Dados: capacidade e tamanhos dos itens
+        const BinPackingData d = loadBinPacking(opts);
+        result.loadTime = timer.lap();
+
+        if (opts.method == "cplex" || opts.method == "mipstart" || opts.method == "inject") {
+            vector<vector<int>> bins;
+            if (!solveArcFlow(env, d, opts, opts.method, result, bins)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
+            }
+            if (!opts.quiet) {
+                printBins(bins);
+            }
+        }
+        else if (opts.method == "check") {
+            vector<vector<int>> bins;
+            if (!solveArcFlow(env, d, opts, "cplex", result, bins)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
+            }
+            string erro;
+            if (!checkBinPacking(d, bins, erro)) {
+                cerr << "Verificação do bin packing falhou (cplex): " << erro << endl;
+                result.status = "Mismatch";
+            }
+            if (!opts.quiet) {
+                printBins(bins);
+                cout << "cplex = " << result.objective << " (resolução " << result.solveTime << " s)" << endl;
+            }
+            for (const string method : {"mipstart", "inject"}) {
+                ProblemResult outro;
+                vector<vector<int>> outrosBins;
+                if (!solveArcFlow(env, d, opts, method, outro, outrosBins)) {
+                    env.error() << "Falha ao resolver o modelo" << endl;
+                    throw(-1);
+                }
+                bool ok = checkBinPacking(d, outrosBins, erro);
+                // Os valores só são comparáveis quando os dois provaram a otimalidade
+                if (ok && result.status == "Optimal" && outro.status == "Optimal" && result.objective != outro.objective) {
+                    erro = "valores " + to_string(result.objective) + " e " + to_string(outro.objective);
+                    ok = false;
+                }
+                if (!ok) {
+                    cerr << "Verificação do bin packing falhou (" << method << "): " << erro << endl;
+                    result.status = "Mismatch";
+                }
+                if (!opts.quiet) {
+                    cout << method << " = " << outro.objective << " (resolução " << outro.solveTime << " s): "
+                         << (ok ? "ok" : erro) << endl;
+                }
+            }
+        }
+        else {
+            throw runtime_error("método desconhecido para BinPackingProblem: " + opts.method);
+        }
+    }
+    catch (IloException& e) {
+        cerr << "Erro CPLEX: " << e << endl;
+    }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
+    catch (...) {
+        cerr << "Erro desconhecido" << endl;
+    }
+    env.end();
+    return result;
+}
@@ -0,0 +1,55 @@
+// LPProblems/Bitset.hpp
+// Conjuntos de vértices em palavras de 64 bits. As operações são laços simples sobre as
+// palavras (o compilador vetoriza com -O2) e as contagens usam popcount.
+#ifndef BITSET_HPP
+#define BITSET_HPP
+#include <cstdint>
+#include <vector>
+#include "Instances.hpp"
+
+using Word = std::uint64_t;
+
+inline int numWords(int n) { return (n + 63) / 64; }
+inline void setBit(Word *b, int v) { b[v >> 6] |= Word(1) << (v & 63); }
+inline void clearBit(Word *b, int v) { b[v >> 6] &= ~(Word(1) << (v & 63)); }
+inline bool testBit(const Word *b, int v) { return (b[v >> 6] >> (v & 63)) & 1; }
+
+inline int popcount(const Word *b, int w) {
+    int total = 0;
+    for (int k = 0; k < w; k++) total += __builtin_popcountll(b[k]);
+    return total;
+}
+
+// Menor elemento do conjunto, ou -1 se vazio
+inline int firstBit(const Word *b, int w) {
+    for (int k = 0; k < w; k++) {
+        if (b[k]) return k * 64 + __builtin_ctzll(b[k]);
+    }
+    return -1;
+}
+
+// Matriz de adjacência: uma linha de bits por vértice
+class BitGraph {
+public:
+    BitGraph() = default;
+    explicit BitGraph(const Graph &g) : BitGraph(g.n) {
+        for (const Edge &e : g.edges) {
+            if (e.from == e.to) continue;
+            setBit(row(e.from), e.to);
+            setBit(row(e.to), e.from);
+        }
+    }
+    explicit BitGraph(int n) : n(n), w(numWords(n)), bits((size_t)n * w, 0) {}
+
+    Word *row(int v) { return &bits[(size_t)v * w]; }
+    const Word *row(int v) const { return &bits[(size_t)v * w]; }
+    bool adjacent(int u, int v) const { return testBit(row(u), v); }
+
+    int n = 0;
+    int w = 0;  // Palavras por linha
+
+private:
+    std::vector<Word> bits;
+};
+
+#endif
@@ -0,0 +1,334 @@
+#include "Clique.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_set>
+
+using namespace std;
+
+MaxCliqueSolver::MaxCliqueSolver(const Graph &g) : g(g), vizinhos(g.n) {
+    for (const Edge &e : g.edges) {
+        if (e.from == e.to) continue;
+        vizinhos[e.from].push_back(e.to);
+        vizinhos[e.to].push_back(e.from);
+    }
+    for (auto &lista : vizinhos) {
+        sort(lista.begin(), lista.end());
+        lista.erase(unique(lista.begin(), lista.end()), lista.end());
+    }
+}
+
+CliqueResult MaxCliqueSolver::solve(double timeLimit) {
+    const int n = g.n;
+    CliqueResult r;
+    inicio = chrono::steady_clock::now();
+    limite = timeLimit;
+    parou = false;
+    nodes = 0;
+    raizCores = 0;
+
+    // Ordem de degenerescência (remove sempre um vértice de grau mínimo) e núcleo de cada vértice
+    vector<int> grau(n), core(n), ordem, posicao(n);
+    int maiorGrau = 0;
+    for (int v = 0; v < n; v++) {
+        grau[v] = vizinhos[v].size();
+        maiorGrau = max(maiorGrau, grau[v]);
+    }
+    vector<vector<int>> baldes(maiorGrau + 1);
+    for (int v = 0; v < n; v++) baldes[grau[v]].push_back(v);
+    vector<char> removido(n, 0);
+    int nucleo = 0;
+    for (int d = 0; (int)ordem.size() < n;) {
+        if (baldes[d].empty()) {
+            d++;
+            continue;
+        }
+        int v = baldes[d].back();
+        baldes[d].pop_back();
+        if (removido[v] || grau[v] != d) continue;  // Entrada obsoleta
+        removido[v] = 1;
+        nucleo = max(nucleo, d);
+        core[v] = nucleo;
+        posicao[v] = ordem.size();
+        ordem.push_back(v);
+        for (int u : vizinhos[v]) {
+            if (!removido[u]) {
+                baldes[--grau[u]].push_back(u);
+                d = min(d, grau[u]);
+            }
+        }
+    }
+
+    // Clique gulosa: cada vértice com os vizinhos removidos depois dele (no máximo
+    // "degenerescência" deles), do maior para o menor núcleo
+    vector<int> heuristica, marca(n, 0);
+    for (int v : ordem) {
+        if (core[v] + 1 <= (int)heuristica.size()) continue;
+        vector<int> cand;
+        for (int u : vizinhos[v]) {
+            if (posicao[u] > posicao[v]) cand.push_back(u);
+        }
+        sort(cand.begin(), cand.end(), [&](int a, int b) { return posicao[a] > posicao[b]; });
+        vector<int> clique = {v};
+        for (int u : vizinhos[v]) marca[u]++;
+        for (int u : cand) {
+            if (marca[u] == (int)clique.size()) {
+                clique.push_back(u);
+                for (int x : vizinhos[u]) marca[x]++;
+            }
+        }
+        for (int x : clique) {
+            for (int y : vizinhos[x]) marca[y] = 0;
+        }
+        if (clique.size() > heuristica.size()) heuristica = clique;
+    }
+    r.heuristic = heuristica.size();
+    melhorTamanho = heuristica.size();
+    melhor.clear();
+
+    // Só vértices com núcleo >= tamanho da clique atual podem estar numa clique maior.
+    // Renumera do último removido (maior núcleo) para o primeiro.
+    original.clear();
+    vector<int> novo(n, -1);
+    for (int k = n - 1; k >= 0; k--) {
+        int v = ordem[k];
+        if (core[v] >= melhorTamanho) {
+            novo[v] = original.size();
+            original.push_back(v);
+        }
+    }
+    const int m = original.size();
+    r.pruned = n - m;
+    if ((double)m * m / 8 > 4e9) throw runtime_error("grafo grande demais para a matriz de bits da clique");
+    adj = BitGraph(m);
+    for (int a = 0; a < m; a++) {
+        for (int u : vizinhos[original[a]]) {
+            if (novo[u] >= 0) setBit(adj.row(a), novo[u]);
+        }
+    }
+
+    if (m > 0) {
+        candidatos.assign(1, vector<Word>(adj.w, 0));
+        candidatos.reserve(m + 2);
+        for (int a = 0; a < m; a++) setBit(candidatos[0].data(), a);
+        ramos.assign(1, {});
+        cores.assign(1, {});
+        ramos.reserve(m + 2);  // expand guarda referências para as listas do seu nível
+        cores.reserve(m + 2);
+        fila.assign(adj.w, 0);
+        livres.assign(adj.w, 0);
+        atual.clear();
+        expand(0);
+    }
+    r.upperBound = max(raizCores, melhorTamanho);
+
+    if (melhor.empty()) {
+        r.clique = heuristica;
+    }
+    else {
+        for (int a : melhor) r.clique.push_back(original[a]);
+    }
+    sort(r.clique.begin(), r.clique.end());
+    r.optimal = !parou;
+    r.nodes = nodes;
+    return r;
+}
+
+void MaxCliqueSolver::expand(int depth) {
+    const int w = adj.w;
+    nodes++;
+    if (limite > 0 && (nodes & 1023) == 0 &&
+        chrono::duration<double>(chrono::steady_clock::now() - inicio).count() > limite) {
+        parou = true;
+    }
+    if (parou) return;
+    if ((int)candidatos.size() <= depth + 1) {
+        candidatos.emplace_back(w);
+        ramos.emplace_back();
+        cores.emplace_back();
+    }
+    Word *P = candidatos[depth].data();
+    vector<int> &lista = ramos[depth], &cor = cores[depth];
+    lista.clear();
+    cor.clear();
+
+    // Coloração gulosa: cada cor é um conjunto independente tirado dos candidatos em ordem.
+    // Só as cores k com |atual| + k > melhor podem melhorar e viram ramos; antes de abrir
+    // um ramo, tenta recolorir o vértice numa cor baixa (Re-NUMBER do MCS).
+    const int kmin = melhorTamanho - (int)atual.size();
+    if ((int)classes.size() < max(kmin, 0) * w) classes.resize((size_t)max(kmin, 0) * w);
+    int k = 0, inicioFila = 0;
+    copy(P, P + w, fila.begin());
+    while (true) {
+        while (inicioFila < w && fila[inicioFila] == 0) inicioFila++;
+        if (inicioFila == w) break;
+        k++;
+        Word *classe = k <= kmin ? &classes[(size_t)(k - 1) * w] : nullptr;
+        if (classe) fill(classe, classe + w, 0);
+        copy(fila.begin() + inicioFila, fila.end(), livres.begin() + inicioFila);
+        for (int p = inicioFila; p < w; p++) {
+            while (livres[p]) {
+                int v = p * 64 + __builtin_ctzll(livres[p]);
+                livres[p] &= livres[p] - 1;
+                clearBit(fila.data(), v);
+                if (classe) {
+                    setBit(classe, v);
+                }
+                else if (recolor(v, kmin)) {
+                    continue;
+                }
+                else {
+                    lista.push_back(v);
+                    cor.push_back(k);
+                }
+                const Word *vz = adj.row(v);
+                for (int q = p; q < w; q++) livres[q] &= ~vz[q];
+            }
+        }
+    }
+    if (depth == 0) raizCores = k;
+
+    // Ramos do maior para o menor rótulo de cor
+    Word *filhos = candidatos[depth + 1].data();
+    for (int t = (int)lista.size() - 1; t >= 0; t--) {
+        if ((int)atual.size() + cor[t] <= melhorTamanho) return;
+        const int v = lista[t];
+        const Word *vz = adj.row(v);
+        int restantes = 0;
+        for (int p = 0; p < w; p++) {
+            filhos[p] = P[p] & vz[p];
+            restantes += __builtin_popcountll(filhos[p]);
+        }
+        atual.push_back(v);
+        if (restantes == 0) {
+            if ((int)atual.size() > melhorTamanho) {
+                melhor = atual;
+                melhorTamanho = atual.size();
+            }
+        }
+        else if ((int)atual.size() + restantes > melhorTamanho) {
+            expand(depth + 1);
+        }
+        atual.pop_back();
+        clearBit(P, v);
+        if (parou) return;
+    }
+}
+
+// Coloca v numa cor k1 <= kmin em que ele tem um único vizinho u, desde que u caiba numa
+// cor k2 > k1 também <= kmin
+bool MaxCliqueSolver::recolor(int v, int kmin) {
+    const int w = adj.w;
+    const Word *vz = adj.row(v);
+    for (int k1 = 0; k1 < kmin; k1++) {
+        Word *c1 = &classes[(size_t)k1 * w];
+        int conflitos = 0, u = -1;
+        for (int p = 0; p < w && conflitos < 2; p++) {
+            Word x = c1[p] & vz[p];
+            if (x) {
+                conflitos += __builtin_popcountll(x);
+                u = p * 64 + __builtin_ctzll(x);
+            }
+        }
+        if (conflitos == 0) {
+            setBit(c1, v);
+            return true;
+        }
+        if (conflitos > 1) continue;
+        const Word *uz = adj.row(u);
+        for (int k2 = k1 + 1; k2 < kmin; k2++) {
+            Word *c2 = &classes[(size_t)k2 * w];
+            bool livre = true;
+            for (int p = 0; p < w && livre; p++) livre = !(c2[p] & uz[p]);
+            if (livre) {
+                clearBit(c1, u);
+                setBit(c2, u);
+                setBit(c1, v);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool checkClique(const Graph &g, const vector<int> &clique, string &erro) {
+    unordered_set<long long> arestas;
+    arestas.reserve(g.edges.size() * 2);
+    for (const Edge &e : g.edges) {
+        arestas.insert((long long)e.from * g.n + e.to);
+        arestas.insert((long long)e.to * g.n + e.from);
+    }
+    vector<char> usado(g.n, 0);
+    for (int v : clique) {
+        if (v < 0 || v >= g.n || usado[v]) {
+            erro = "vértice inválido ou repetido na clique";
+            return false;
+        }
+        usado[v] = 1;
+    }
+    for (size_t a = 0; a < clique.size(); a++) {
+        for (size_t b = a + 1; b < clique.size(); b++) {
+            if (!arestas.count((long long)clique[a] * g.n + clique[b])) {
+                erro = "vértices " + to_string(clique[a] + 1) + " e " + to_string(clique[b] + 1) + " não são adjacentes";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Para cada vértice i, enquanto houver um não vizinho j > i cujo par ainda não está coberto,
+// cria um conjunto independente com {i, j} e o estende gulosamente até ficar maximal,
+// preferindo vértices que cobrem pares novos com i
+vector<vector<int>> independentSetCover(const Graph &g) {
+    const int n = g.n;
+    const BitGraph adj(g);
+    const int w = adj.w;
+    BitGraph coberto(n);
+    vector<Word> naoCobertos(w), cand(w), conjunto(w);
+    const Word ultima = n % 64 ? (Word(1) << (n % 64)) - 1 : ~Word(0);
+
+    vector<vector<int>> conjuntos;
+    for (int i = 0; i < n; i++) {
+        const Word *vi = adj.row(i);
+        while (true) {
+            // Não vizinhos j > i cujo par com i ainda não está coberto
+            for (int p = 0; p < w; p++) naoCobertos[p] = ~vi[p] & ~coberto.row(i)[p];
+            naoCobertos[w - 1] &= ultima;
+            for (int p = 0; p < i / 64; p++) naoCobertos[p] = 0;
+            naoCobertos[i / 64] &= ~Word(0) << (i % 64);
+            clearBit(naoCobertos.data(), i);
+            int j = firstBit(naoCobertos.data(), w);
+            if (j < 0) break;
+
+            vector<int> membros = {i, j};
+            const Word *vj = adj.row(j);
+            for (int p = 0; p < w; p++) cand[p] = ~vi[p] & ~vj[p];
+            cand[w - 1] &= ultima;
+            clearBit(cand.data(), i);
+            clearBit(cand.data(), j);
+            while (true) {
+                int x = -1;
+                for (int p = 0; p < w && x < 0; p++) {
+                    if (cand[p] & naoCobertos[p]) x = p * 64 + __builtin_ctzll(cand[p] & naoCobertos[p]);
+                }
+                if (x < 0) x = firstBit(cand.data(), w);
+                if (x < 0) break;
+                membros.push_back(x);
+                const Word *vx = adj.row(x);
+                for (int p = 0; p < w; p++) cand[p] &= ~vx[p];
+                clearBit(cand.data(), x);
+            }
+
+            fill(conjunto.begin(), conjunto.end(), 0);
+            for (int v : membros) setBit(conjunto.data(), v);
+            for (int v : membros) {
+                Word *cv = coberto.row(v);
+                for (int p = 0; p < w; p++) cv[p] |= conjunto[p];
+            }
+            sort(membros.begin(), membros.end());
+            conjuntos.push_back(move(membros));
+        }
+    }
+    return conjuntos;
+}
@@ -0,0 +1,68 @@
+// LPProblems/Clique.hpp
+// Clique máxima nativa (sem CPLEX): branch-and-bound no estilo MCS/Tomita com conjuntos em
+// bitsets (BBMC).
+//
+// - Pré-processamento: ordem de degenerescência, clique gulosa inicial e remoção dos
+//   vértices cujo núcleo (core) é pequeno demais para uma clique maior que a inicial.
+// - Os vértices restantes são renumerados do maior para o menor núcleo; a coloração gulosa
+//   de cada nó percorre os candidatos nessa ordem, palavra a palavra, e só os vértices cuja
+//   cor ainda pode melhorar a melhor clique viram ramos (do maior para o menor rótulo).
+// - Candidatos de um filho: AND da linha de adjacência com os candidatos do pai, com a
+//   contagem (popcount) no mesmo laço como limite rápido antes da coloração.
+//
+// Também monta as desigualdades de cobertura por conjuntos independentes usadas no modelo
+// CPLEX: cada par não adjacente fica em pelo menos um conjunto independente maximal.
+#ifndef CLIQUE_HPP
+#define CLIQUE_HPP
+#include <chrono>
+#include <string>
+#include <vector>
+#include "Bitset.hpp"
+#include "Instances.hpp"
+
+struct CliqueResult {
+    std::vector<int> clique;  // Vértices da entrada, em ordem crescente
+    bool optimal = true;      // false se o limite de tempo interrompeu a busca
+    int heuristic = 0;        // Tamanho da clique gulosa inicial
+    int upperBound = 0;       // Cores da coloração da raiz (limite superior)
+    int pruned = 0;           // Vértices removidos pelo núcleo antes da busca
+    long long nodes = 0;
+};
+
+class MaxCliqueSolver {
+public:
+    explicit MaxCliqueSolver(const Graph &g);
+
+    // timeLimit em segundos (0: sem limite)
+    CliqueResult solve(double timeLimit = 0);
+
+private:
+    void expand(int depth);
+    bool recolor(int v, int kmin);
+
+    const Graph &g;
+    std::vector<std::vector<int>> vizinhos;  // Listas de adjacência sem repetições
+    std::vector<int> original;               // Vértice da entrada de cada vértice renumerado
+    BitGraph adj;
+
+    // Estado da busca: candidatos e lista de ramos por profundidade
+    std::vector<std::vector<Word>> candidatos;
+    std::vector<std::vector<int>> ramos, cores;
+    std::vector<Word> fila, livres;  // Rascunho da coloração
+    std::vector<Word> classes;       // Cores 1..kmin da coloração em curso
+    std::vector<int> atual, melhor;
+    int melhorTamanho = 0;
+    int raizCores = 0;
+    long long nodes = 0;
+    bool parou = false;
+    double limite = 0;
+    std::chrono::steady_clock::time_point inicio;
+};
+
+// Verifica se os vértices são distintos e dois a dois adjacentes
+bool checkClique(const Graph &g, const std::vector<int> &clique, std::string &erro);
+
+// Conjuntos independentes maximais que cobrem todos os pares não adjacentes
+std::vector<std::vector<int>> independentSetCover(const Graph &g);
+
+#endif
@@ -0,0 +1,206 @@
+#include "Coloring.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <random>
+#include <set>
+#include <tuple>
+#include "Clique.hpp"
+
+using namespace std;
+
+namespace {
+
+vector<vector<int>> adjacencyLists(const Graph &g) {
+    vector<vector<int>> vizinhos(g.n);
+    for (const Edge &e : g.edges) {
+        if (e.from == e.to) continue;
+        vizinhos[e.from].push_back(e.to);
+        vizinhos[e.to].push_back(e.from);
+    }
+    for (auto &lista : vizinhos) {
+        sort(lista.begin(), lista.end());
+        lista.erase(unique(lista.begin(), lista.end()), lista.end());
+    }
+    return vizinhos;
+}
+
+}  // namespace
+
+vector<int> dsatur(const Graph &g) {
+    const int n = g.n;
+    const vector<vector<int>> vizinhos = adjacencyLists(g);
+    vector<int> cor(n, -1), saturacao(n, 0);
+    vector<vector<char>> vistas(n);  // Cores já usadas na vizinhança de cada vértice
+
+    // Próximo vértice: maior saturação, depois maior grau, depois menor índice
+    set<tuple<int, int, int>> fila;
+    for (int v = 0; v < n; v++) fila.insert({0, -(int)vizinhos[v].size(), v});
+    while (!fila.empty()) {
+        int v = get<2>(*fila.begin());
+        fila.erase(fila.begin());
+        int c = 0;
+        while (c < (int)vistas[v].size() && vistas[v][c]) c++;
+        cor[v] = c;
+        for (int u : vizinhos[v]) {
+            if (cor[u] >= 0) continue;
+            if ((int)vistas[u].size() <= c) vistas[u].resize(c + 1, 0);
+            if (vistas[u][c]) continue;
+            vistas[u][c] = 1;
+            fila.erase({-saturacao[u], -(int)vizinhos[u].size(), u});
+            saturacao[u]++;
+            fila.insert({-saturacao[u], -(int)vizinhos[u].size(), u});
+        }
+    }
+    return cor;
+}
+
+bool tabucol(const Graph &g, int k, vector<int> &color, long long maxIterations, unsigned seed,
+             long long &iterations, double timeLimit) {
+    const auto inicio = chrono::steady_clock::now();
+    const int n = g.n;
+    const vector<vector<int>> vizinhos = adjacencyLists(g);
+    mt19937 rng(seed);
+
+    // Vértices com cor >= k vão para a cor com menos vizinhos já coloridos
+    vector<int> contagem(k);
+    for (int v = 0; v < n; v++) {
+        if (color[v] >= 0 && color[v] < k) continue;
+        fill(contagem.begin(), contagem.end(), 0);
+        for (int u : vizinhos[v]) {
+            if (color[u] >= 0 && color[u] < k) contagem[color[u]]++;
+        }
+        color[v] = min_element(contagem.begin(), contagem.end()) - contagem.begin();
+    }
+
+    // gamma[v * k + c]: vizinhos de v com a cor c
+    vector<int> gamma((size_t)n * k, 0);
+    for (int v = 0; v < n; v++) {
+        for (int u : vizinhos[v]) gamma[(size_t)v * k + color[u]]++;
+    }
+    long long conflitos = 0;
+    vector<int> emConflito, posicao(n, -1);
+    auto atualiza = [&](int v) {
+        bool conflita = gamma[(size_t)v * k + color[v]] > 0;
+        if (conflita && posicao[v] < 0) {
+            posicao[v] = emConflito.size();
+            emConflito.push_back(v);
+        }
+        else if (!conflita && posicao[v] >= 0) {
+            int ultimo = emConflito.back();
+            emConflito[posicao[v]] = ultimo;
+            posicao[ultimo] = posicao[v];
+            emConflito.pop_back();
+            posicao[v] = -1;
+        }
+    };
+    for (int v = 0; v < n; v++) {
+        conflitos += gamma[(size_t)v * k + color[v]];
+        atualiza(v);
+    }
+    conflitos /= 2;
+
+    // Movimento: vértice em conflito para outra cor, com a menor variação de conflitos.
+    // O par (vértice, cor antiga) fica tabu por 0,6 * |conflitantes| + [0, 10) iterações,
+    // a menos que o movimento leve a menos conflitos que o melhor já visto.
+    vector<long long> tabu((size_t)n * k, 0);
+    long long melhor = conflitos, it = 0;
+    for (; it < maxIterations && conflitos > 0; it++) {
+        if (timeLimit > 0 && (it & 255) == 0 &&
+            chrono::duration<double>(chrono::steady_clock::now() - inicio).count() > timeLimit) {
+            break;
+        }
+        int melhorDelta = INT_MAX, escolhido = -1, novaCor = -1, empates = 0;
+        for (int v : emConflito) {
+            const int *gv = &gamma[(size_t)v * k];
+            const int atual = gv[color[v]];
+            for (int c = 0; c < k; c++) {
+                if (c == color[v]) continue;
+                int delta = gv[c] - atual;
+                if (delta > melhorDelta) continue;
+                if (tabu[(size_t)v * k + c] > it && conflitos + delta >= melhor) continue;
+                if (delta < melhorDelta) {
+                    melhorDelta = delta;
+                    empates = 0;
+                }
+                if (rng() % ++empates == 0) {
+                    escolhido = v;
+                    novaCor = c;
+                }
+            }
+        }
+        if (escolhido < 0) continue;  // Todos os movimentos tabu
+
+        const int v = escolhido, antiga = color[v];
+        color[v] = novaCor;
+        for (int u : vizinhos[v]) {
+            gamma[(size_t)u * k + antiga]--;
+            gamma[(size_t)u * k + novaCor]++;
+            if (color[u] == antiga || color[u] == novaCor) atualiza(u);
+        }
+        atualiza(v);
+        conflitos += melhorDelta;
+        tabu[(size_t)v * k + antiga] = it + (long long)(0.6 * emConflito.size()) + rng() % 10;
+        melhor = min(melhor, conflitos);
+    }
+    iterations += it;
+    return conflitos == 0;
+}
+
+ColoringResult colorGraph(const Graph &g, double timeLimit, unsigned seed) {
+    const auto inicio = chrono::steady_clock::now();
+    auto decorrido = [&] { return chrono::duration<double>(chrono::steady_clock::now() - inicio).count(); };
+
+    ColoringResult r;
+    r.color = dsatur(g);
+    r.colors = g.n > 0 ? *max_element(r.color.begin(), r.color.end()) + 1 : 0;
+    r.dsaturColors = r.colors;
+
+    // Limite inferior: metade do tempo para a clique
+    MaxCliqueSolver clique(g);
+    r.clique = clique.solve(timeLimit > 0 ? timeLimit / 2 : 0).clique;
+
+    const long long maxIterations = 100000 + 10LL * g.n;
+    while (r.colors > (int)r.clique.size() && (timeLimit <= 0 || decorrido() < timeLimit)) {
+        vector<int> tentativa = r.color;
+        double resta = timeLimit > 0 ? timeLimit - decorrido() : 0;
+        if (!tabucol(g, r.colors - 1, tentativa, maxIterations, seed++, r.iterations, resta)) break;
+
+        // O tabucol pode deixar cores sem uso: renumera as usadas
+        vector<int> nova(r.colors - 1, -1);
+        r.colors = 0;
+        for (int &c : tentativa) {
+            if (nova[c] < 0) nova[c] = r.colors++;
+            c = nova[c];
+        }
+        r.color = tentativa;
+    }
+    return r;
+}
+
+bool checkColoring(const Graph &g, const vector<int> &color, int colors, string &erro) {
+    if ((int)color.size() != g.n) {
+        erro = "coloração com tamanho errado";
+        return false;
+    }
+    vector<char> usada(colors, 0);
+    for (int v = 0; v < g.n; v++) {
+        if (color[v] < 0 || color[v] >= colors) {
+            erro = "cor fora do intervalo no vértice " + to_string(v + 1);
+            return false;
+        }
+        usada[color[v]] = 1;
+    }
+    if (count(usada.begin(), usada.end(), 0) > 0) {
+        erro = "alguma cor não é usada";
+        return false;
+    }
+    for (const Edge &e : g.edges) {
+        if (e.from != e.to && color[e.from] == color[e.to]) {
+            erro = "vértices " + to_string(e.from + 1) + " e " + to_string(e.to + 1) + " com a mesma cor";
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,41 @@
+// LPProblems/Coloring.hpp
+// Coloração de grafos nativa (sem CPLEX) para o FrequencyProblem.
+//
+// - DSATUR: colore primeiro o vértice com mais cores distintas na vizinhança (empate: maior
+//   grau), sempre com a menor cor livre.
+// - Tabucol: partindo de uma coloração com k cores, tira a última cor e busca uma
+//   coloração sem conflitos com k - 1 cores (movimentos de vértices em conflito, lista tabu
+//   por par vértice/cor), repetindo enquanto conseguir.
+// - Limite inferior: uma clique do mesmo grafo (MaxCliqueSolver); se a coloração usar
+//   tantas cores quanto a clique tem vértices, ela é ótima.
+#ifndef COLORING_HPP
+#define COLORING_HPP
+#include <string>
+#include <vector>
+#include "Instances.hpp"
+
+struct ColoringResult {
+    std::vector<int> color;   // Cor de cada vértice (0..colors-1)
+    int colors = 0;
+    int dsaturColors = 0;     // Cores da solução inicial do DSATUR
+    std::vector<int> clique;  // Clique que dá o limite inferior
+    long long iterations = 0; // Iterações do tabucol
+    bool optimal() const { return colors == (int)clique.size(); }
+};
+
+std::vector<int> dsatur(const Graph &g);
+
+// Procura uma coloração sem conflitos com k cores a partir de "color" (cores >= k são
+// redistribuídas), por no máximo maxIterations iterações ou timeLimit segundos (0: sem
+// limite de tempo). Devolve true e a coloração em "color" se encontrar.
+bool tabucol(const Graph &g, int k, std::vector<int> &color, long long maxIterations, unsigned seed,
+             long long &iterations, double timeLimit = 0);
+
+// DSATUR, tabucol enquanto reduzir cores e clique para o limite inferior.
+// timeLimit em segundos (0: sem limite), dividido entre a clique e o tabucol.
+ColoringResult colorGraph(const Graph &g, double timeLimit = 0, unsigned seed = 1);
+
+// Verifica se a coloração é própria e usa exatamente as cores 0..colors-1
+bool checkColoring(const Graph &g, const std::vector<int> &color, int colors, std::string &erro);
+
+#endif
@@ -1,72 +1,172 @@
 #include <ilcplex/ilocplex.h>
+#include <cmath>
 #include <vector>
 #include <iostream>
+#include <stdexcept>
+#include "Problems.hpp"
+#include "VertexCover.hpp"
+#include "ModelBuilder.hpp"
 ILOSTLBEGIN
 
-struct Edge {
-    int from;
-    int to;
-};
+// Modelo: x[v] = 1 se o vértice v entra na cobertura, com uma restrição x[u] + x[v] >= 1
+// por aresta (construção O(V + E)). O modelo é montado só sobre o núcleo das reduções, e
+// a cobertura do núcleo é levantada para o grafo original.
+static bool solveCplex(IloEnv env, const VertexCoverKernel &kernel, const ProblemOptions &opts,
+                       ProblemResult &result, vector<int> &cover) {
+    Timer timer;
+    const Graph &g = kernel.kernel();
+    const int NUM_NOS = g.n;
+    vector<int> kernelCover;
 
-int CoverProblem() {
-    IloEnv env;
-    try {
+    if (NUM_NOS > 0) {
         // Criar modelo
         IloModel model(env);
-
-        //Constantes
-        const int NUM_NOS = 5;
-        const std::vector<Edge> EDGES = {
-            {0, 1}, 
-            {0, 2}, 
-            {1, 2}, 
-            {1, 3}, 
-            {2, 3}, 
-            {3, 4} 
-        };
+        ModelBuilder mb(env, opts);
 
         // Variáveis de decisão
-        IloIntVarArray x(env, NUM_NOS, 0, 1);
+        const int x = mb.addVars(NUM_NOS, 0, 1, IloNumVar::Int, [](int i) { return "X" + std::to_string(i); });
+
+        // Função objetivo: minimizar o número de vértices na cobertura
         for (int i = 0; i < NUM_NOS; i++) {
-            x[i].setName(("X" + std::to_string(i)).c_str());
+            mb.setObjective(x + i, 1);
         }
 
-        // Função objetivo: minimizar o número de nós cobertos
-        model.add(IloMinimize(env, IloSum(x)));
-
-        // Restrições: cada vértice deve ser coberto por pelo menos um nó
-        for (int i = 0; i < NUM_NOS; i++) {
-            IloExpr expr(env);
-            for (const auto& edge : EDGES) {
-                if (edge.from == i || edge.to == i) {
-                    expr += x[edge.from] + x[edge.to];
-                }
-            }
-            model.add(expr >= 1);
-            expr.end();
+        // Restrições: cada aresta tem pelo menos uma ponta na cobertura
+        for (const auto &edge : g.edges) {
+            mb.addRow(1, IloInfinity, {x + edge.from, x + edge.to});
         }
+        mb.extract(model, IloObjective::Minimize);
 
         // Resolver
         IloCplex cplex(model);
-        if (!cplex.solve()) {
-            env.error() << "Falha ao resolver o modelo" << endl;
-            throw(-1);
+        result.buildTime = timer.lap();
+        if (!solveModel(cplex, opts, result)) {
+            return false;
         }
-        
-        // Resultados
-        cout << "Solução ótima = " << cplex.getObjValue() << endl;
-        // Nós cobertos
+        IloNumArray valores(env);
+        cplex.getValues(valores, mb.vars());
         for (int i = 0; i < NUM_NOS; i++) {
-            cout << x[i].getName() << ": " << cplex.getValue(x[i]) << endl;
+            if (valores[x + i] > 0.5) {
+                kernelCover.push_back(i);
+            }
+        }
+        valores.end();
+    }
+    else {
+        // As reduções resolveram o grafo inteiro
+        result.buildTime = timer.lap();
+        result.status = "Optimal";
+        result.gap = 0;
+    }
+    cover = kernel.lift(kernelCover);
+    // O CPLEX só vê o núcleo: objetivo e gap relativos ao grafo todo
+    if (!cover.empty() && !std::isnan(result.gap)) {
+        result.gap *= (double)kernelCover.size() / cover.size();
+    }
+    result.objective = cover.size();
+    return true;
+}
+
+// Branch-and-reduce nativo sobre o núcleo (respeita o limite de tempo das opções)
+static CoverResult solveNative(const VertexCoverKernel &kernel, const ProblemOptions &opts, ProblemResult &result) {
+    Timer timer;
+    CoverResult r = solveVertexCover(kernel, opts.timeLimit);
+    result.solveTime = timer.lap();
+    result.status = r.optimal ? "Optimal" : "Feasible";
+    result.objective = r.cover.size();
+    result.nodes = r.nodes;
+    result.gap = r.cover.empty() ? 0 : (double)(r.cover.size() - r.lowerBound) / r.cover.size();
+    return r;
+}
+
+static void printCover(const vector<int> &cover) {
+    cout << "Solução ótima = " << cover.size() << endl;
+    cout << "Vértices na cobertura: " << cover.size() << endl;
+    for (size_t k = 0; k < cover.size() && k < (size_t)MAX_DETALHES; k++) {
+        cout << "\tVértice " << cover[k] << " faz parte da cobertura" << endl;
+    }
+}
+
+// Métodos (opts.method): "cplex" (padrão), "bnr" (branch-and-reduce nativo) ou "check", que
+// resolve pelos dois, confere as coberturas e compara os tamanhos. Os dois partem do núcleo
+// das reduções de grau 0/1/2, coroa e LP (Nemhauser–Trotter), cujo tempo entra na construção.
+ProblemResult CoverProblem(const ProblemOptions &opts) {
+    ProblemResult result;
+    IloEnv env;
+    try {
+        Timer timer;
+        // Dados
+        const Graph g = loadCoverGraph(opts);
+        result.loadTime = timer.lap();
+
+        VertexCoverKernel kernel(g);
+        kernel.reduce();
+        double tempoNucleo = timer.lap();
+        if (!opts.quiet) {
+            cout << "Núcleo: " << kernel.kernel().n << " de " << g.n << " vértices, " << kernel.kernel().edges.size()
+                 << " arestas (removidos por grau 0: " << kernel.grau0 << ", grau 1: " << kernel.grau1
+                 << ", grau 2: " << kernel.grau2 << ", coroa: " << kernel.coroa << ", LP: " << kernel.lp
+                 << "); limite inferior " << kernel.lowerBound() << endl;
+        }
+
+        if (opts.method == "bnr") {
+            CoverResult r = solveNative(kernel, opts, result);
+            result.buildTime = tempoNucleo;
+            if (!opts.quiet) {
+                printCover(r.cover);
+                cout << "Branch-and-reduce: " << r.nodes << " nós" << endl;
+            }
+        }
+        else if (opts.method == "check") {
+            ProblemResult nativo;
+            CoverResult r = solveNative(kernel, opts, nativo);
+            vector<int> cover;
+            if (!solveCplex(env, kernel, opts, result, cover)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
+            }
+            result.buildTime += tempoNucleo;
+            string erro;
+            bool ok = checkVertexCover(g, r.cover, erro) && checkVertexCover(g, cover, erro);
+            if (ok && r.optimal && r.cover.size() != cover.size()) {
+                ok = false;
+                erro = "tamanhos diferentes";
+            }
+            if (!ok) {
+                cerr << "Verificação da cobertura falhou: " << erro << endl;
+                result.status = "Mismatch";
+            }
+            if (!opts.quiet) {
+                printCover(cover);
+                cout << "Branch-and-reduce = " << r.cover.size() << " (" << nativo.solveTime << " s, " << r.nodes
+                     << " nós), CPLEX = " << cover.size() << " (" << result.solveTime
+                     << " s): " << (ok ? "ok" : erro) << endl;
+            }
+        }
+        else if (opts.method == "cplex") {
+            vector<int> cover;
+            if (!solveCplex(env, kernel, opts, result, cover)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
+            }
+            result.buildTime += tempoNucleo;
+            if (!opts.quiet) {
+                printCover(cover);
+            }
+        }
+        else {
+            throw runtime_error("método desconhecido para CoverProblem: " + opts.method);
         }
-        
     }
     catch (IloException& e) {
         cerr << "Erro CPLEX: " << e << endl;
     }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
     catch (...) {
         cerr << "Erro desconhecido" << endl;
     }
     env.end();
-    return 0;
-}
\ No newline at end of file
+    return result;
+}
@@ -0,0 +1,158 @@
+#include "CuttingStock.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+using namespace std;
+
+PatternPricer::PatternPricer(const CuttingStockData &d)
+    : d(d), melhor(d.larguraRolo + 1), escolha(d.larguraRolo + 1), contagem(d.numItens, 0) {
+    for (int i = 0; i < d.numItens; i++) larguras.push_back(d.largura[i]);
+    sort(larguras.begin(), larguras.end());
+    larguras.erase(unique(larguras.begin(), larguras.end()), larguras.end());
+    porLargura.resize(larguras.size());
+}
+
+double PatternPricer::price(const vector<double> &duais, CuttingPattern &padrao) {
+    const long long W = d.larguraRolo;
+    fill(melhor.begin(), melhor.end(), 0.0);
+    fill(escolha.begin(), escolha.end(), -1);
+    // Entre itens de mesma largura só o de maior dual entra na mochila
+    fill(porLargura.begin(), porLargura.end(), -1);
+    for (int i = 0; i < d.numItens; i++) {
+        int &j = porLargura[lower_bound(larguras.begin(), larguras.end(), d.largura[i]) - larguras.begin()];
+        if (j < 0 || duais[i] > duais[j]) j = i;
+    }
+    // Mochila ilimitada: percorrer c em ordem crescente permite repetir o item
+    for (int i : porLargura) {
+        const double valor = duais[i];
+        if (valor <= 1e-12) continue;
+        const long long w = d.largura[i];
+        for (long long c = w; c <= W; c++) {
+            double candidato = melhor[c - w] + valor;
+            if (candidato > melhor[c] + 1e-12) {
+                melhor[c] = candidato;
+                escolha[c] = i;
+            }
+        }
+    }
+
+    // Reconstrução: o último item que melhorou melhor[c] não foi superado depois, então
+    // melhor[c] = melhor[c - largura] + valor também no vetor final
+    padrao.itens.clear();
+    padrao.qtd.clear();
+    for (long long c = W; c > 0 && escolha[c] >= 0; c -= d.largura[escolha[c]]) {
+        int i = escolha[c];
+        if (contagem[i]++ == 0) padrao.itens.push_back(i);
+    }
+    sort(padrao.itens.begin(), padrao.itens.end());
+    for (int i : padrao.itens) {
+        padrao.qtd.push_back(contagem[i]);
+        contagem[i] = 0;
+    }
+    return melhor[W];
+}
+
+CuttingSolution greedyCutting(const CuttingStockData &d, const vector<long long> &demanda) {
+    CuttingSolution s;
+    vector<long long> resto = demanda;
+    vector<int> ativos;  // Itens com demanda restante, do mais largo ao mais estreito
+    for (int i = 0; i < d.numItens; i++) {
+        if (resto[i] > 0) ativos.push_back(i);
+    }
+    stable_sort(ativos.begin(), ativos.end(), [&](int a, int b) { return d.largura[a] > d.largura[b]; });
+
+    while (!ativos.empty()) {
+        CuttingPattern padrao;
+        long long livre = d.larguraRolo;
+        long long vezes = -1;
+        for (int i : ativos) {
+            if (d.largura[i] > livre) continue;
+            long long q = min(resto[i], livre / d.largura[i]);
+            padrao.itens.push_back(i);
+            padrao.qtd.push_back(q);
+            livre -= q * d.largura[i];
+            long long cabe = resto[i] / q;
+            if (vezes < 0 || cabe < vezes) vezes = cabe;
+        }
+        // Repete o padrão enquanto todos os seus itens ainda têm demanda
+        for (size_t k = 0; k < padrao.itens.size(); k++) {
+            resto[padrao.itens[k]] -= vezes * padrao.qtd[k];
+        }
+        s.padroes.push_back(move(padrao));
+        s.vezes.push_back(vezes);
+        s.rolos += vezes;
+        ativos.erase(remove_if(ativos.begin(), ativos.end(), [&](int i) { return resto[i] <= 0; }), ativos.end());
+    }
+    for (CuttingPattern &p : s.padroes) {
+        vector<int> ordem(p.itens.size());
+        iota(ordem.begin(), ordem.end(), 0);
+        sort(ordem.begin(), ordem.end(), [&](int a, int b) { return p.itens[a] < p.itens[b]; });
+        CuttingPattern ordenado;
+        for (int k : ordem) {
+            ordenado.itens.push_back(p.itens[k]);
+            ordenado.qtd.push_back(p.qtd[k]);
+        }
+        p = move(ordenado);
+    }
+    return s;
+}
+
+CuttingSolution roundCutting(const CuttingStockData &d, const vector<CuttingPattern> &padroes,
+                             const vector<double> &x) {
+    CuttingSolution s;
+    vector<long long> resto = d.demanda;
+    for (size_t p = 0; p < padroes.size(); p++) {
+        long long vezes = (long long)floor(x[p] + 1e-9);
+        if (vezes <= 0) continue;
+        for (size_t k = 0; k < padroes[p].itens.size(); k++) {
+            resto[padroes[p].itens[k]] -= vezes * padroes[p].qtd[k];
+        }
+        s.padroes.push_back(padroes[p]);
+        s.vezes.push_back(vezes);
+        s.rolos += vezes;
+    }
+    for (long long &r : resto) r = max(0LL, r);
+    CuttingSolution residuo = greedyCutting(d, resto);
+    for (size_t k = 0; k < residuo.padroes.size(); k++) {
+        s.padroes.push_back(move(residuo.padroes[k]));
+        s.vezes.push_back(residuo.vezes[k]);
+    }
+    s.rolos += residuo.rolos;
+    return s;
+}
+
+bool checkCutting(const CuttingStockData &d, const CuttingSolution &s, string &erro) {
+    vector<long long> produzido(d.numItens, 0);
+    long long rolos = 0;
+    for (size_t p = 0; p < s.padroes.size(); p++) {
+        const CuttingPattern &padrao = s.padroes[p];
+        long long usado = 0;
+        for (size_t k = 0; k < padrao.itens.size(); k++) {
+            int i = padrao.itens[k];
+            if (i < 0 || i >= d.numItens || padrao.qtd[k] < 0) {
+                erro = "padrão " + to_string(p + 1) + " inválido";
+                return false;
+            }
+            usado += padrao.qtd[k] * d.largura[i];
+            produzido[i] += padrao.qtd[k] * s.vezes[p];
+        }
+        if (usado > d.larguraRolo) {
+            erro = "padrão " + to_string(p + 1) + " excede a largura do rolo";
+            return false;
+        }
+        rolos += s.vezes[p];
+    }
+    for (int i = 0; i < d.numItens; i++) {
+        if (produzido[i] < d.demanda[i]) {
+            erro = "demanda do item " + to_string(i + 1) + " não atendida";
+            return false;
+        }
+    }
+    if (rolos != s.rolos) {
+        erro = "total de rolos incorreto";
+        return false;
+    }
+    return true;
+}
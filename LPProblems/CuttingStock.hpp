@@ -0,0 +1,60 @@
+// LPProblems/CuttingStock.hpp
+// Partes do corte de rolos (Gilmore–Gomory) que não dependem do CPLEX.
+//
+// O mestre do CuttingStockProblem é min sum_p x_p com sum_p a_ip x_p >= demanda_i sobre os
+// padrões gerados até agora; com os duais pi das demandas, um padrão novo só melhora o LP
+// se sum_i pi_i a_i > 1. O oráculo de precificação é a mochila inteira ilimitada
+//     max sum_i pi_i a_i   com   sum_i largura_i a_i <= larguraRolo,
+// resolvida por programação dinâmica O(n * larguraRolo) com vetores reaproveitados entre
+// as rodadas. Com z o valor do LP restrito e v o valor da mochila, z / v é um limite
+// inferior do LP completo (Farley), o que permite parar antes quando ceil(z / v) = ceil(z).
+//
+// Também ficam aqui a heurística gulosa (padrões repetidos enquanto a demanda permite), que
+// dá as colunas iniciais e a solução de partida, o arredondamento da solução do LP (parte
+// inteira + gulosa no resíduo) e a conferência de uma solução.
+#ifndef CUTTING_STOCK_HPP
+#define CUTTING_STOCK_HPP
+#include <string>
+#include <vector>
+#include "Instances.hpp"
+
+// Padrão de corte: "qtd[k]" peças do item "itens[k]" em um rolo
+struct CuttingPattern {
+    std::vector<int> itens;
+    std::vector<int> qtd;
+};
+
+// Solução inteira: o padrão k é cortado "vezes[k]" vezes
+struct CuttingSolution {
+    std::vector<CuttingPattern> padroes;
+    std::vector<long long> vezes;
+    long long rolos = 0;
+};
+
+class PatternPricer {
+public:
+    explicit PatternPricer(const CuttingStockData &d);
+
+    // Padrão de maior valor sum duais[i] * a_i; devolve esse valor
+    double price(const std::vector<double> &duais, CuttingPattern &padrao);
+
+private:
+    const CuttingStockData &d;
+    std::vector<double> melhor;  // melhor[c]: maior valor com largura <= c
+    std::vector<int> escolha;    // Último item que melhorou melhor[c]; -1 se nenhum
+    std::vector<int> contagem;   // Peças de cada item no padrão em reconstrução
+    std::vector<long long> larguras;  // Larguras distintas, em ordem crescente
+    std::vector<int> porLargura;      // Item de maior dual de cada largura
+};
+
+// Gulosa: maior item primeiro, cada padrão repetido enquanto nenhuma peça sobra
+CuttingSolution greedyCutting(const CuttingStockData &d, const std::vector<long long> &demanda);
+
+// Parte inteira de "x" nos padrões e a gulosa na demanda restante
+CuttingSolution roundCutting(const CuttingStockData &d, const std::vector<CuttingPattern> &padroes,
+                             const std::vector<double> &x);
+
+// Confere larguras, demandas e o total de rolos; false com a mensagem em "erro"
+bool checkCutting(const CuttingStockData &d, const CuttingSolution &s, std::string &erro);
+
+#endif
@@ -0,0 +1,231 @@
+#include <ilcplex/ilocplex.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <iostream>
+#include <stdexcept>
+#include "Problems.hpp"
+#include "CuttingStock.hpp"
+ILOSTLBEGIN
+
+// Corte de rolos por geração de colunas (Gilmore–Gomory). O mestre começa com os padrões
+// da heurística gulosa e cresce uma coluna por rodada, dada pela mochila de precificação
+// (CuttingStock.hpp); como as rodadas só acrescentam colunas, cada LP é resolvido pelo
+// simplex primal a partir da base da rodada anterior. A integralidade vem do arredondamento
+// da última solução do LP e, no método "cplex", do MIP sobre as colunas geradas
+// (preço-e-ramificação, sem gerar colunas nos nós), partindo da melhor solução conhecida.
+
+// Estatísticas da geração de colunas
+struct ColumnGeneration {
+    int rodadas = 0;
+    int colunas = 0;
+    double lp = NAN;       // Valor do último LP restrito
+    long long limite = 0;  // Limite inferior inteiro (LP ou Farley, arredondado para cima)
+    double tempo = 0;
+};
+
+static bool solveColumnGeneration(IloEnv env, const CuttingStockData &d, const ProblemOptions &opts, bool inteiro,
+                                  ProblemResult &result, CuttingSolution &solucao, ColumnGeneration &cg) {
+    Timer timer;
+    const int ITENS = d.numItens;
+
+    // Colunas iniciais e solução de partida: a heurística gulosa
+    solucao = greedyCutting(d, d.demanda);
+    vector<CuttingPattern> padroes = solucao.padroes;
+
+    // Mestre: min sum x_p com as demandas atendidas
+    IloModel model(env);
+    IloObjective rolos = IloMinimize(env);
+    model.add(rolos);
+    IloNumArray lb(env, ITENS), ub(env, ITENS);
+    for (int i = 0; i < ITENS; i++) {
+        lb[i] = d.demanda[i];
+        ub[i] = IloInfinity;
+    }
+    IloRangeArray demanda(env, lb, ub);
+    lb.end();
+    ub.end();
+    model.add(demanda);
+    IloNumVarArray x(env);
+    auto addColumn = [&](const CuttingPattern &p) {
+        IloNumColumn coluna = rolos(1);
+        for (size_t k = 0; k < p.itens.size(); k++) {
+            coluna += demanda[p.itens[k]](p.qtd[k]);
+        }
+        x.add(IloNumVar(coluna));
+        coluna.end();
+    };
+    for (const CuttingPattern &p : padroes) addColumn(p);
+
+    IloCplex cplex(model);
+    if (!opts.cplexLog) {
+        cplex.setOut(env.getNullStream());
+        cplex.setWarning(env.getNullStream());
+    }
+    if (opts.threads > 0) cplex.setParam(IloCplex::Param::Threads, opts.threads);
+    cplex.setParam(IloCplex::Param::RootAlgorithm, IloCplex::Primal);
+    result.buildTime = timer.lap();
+
+    // Rodadas: LP restrito, duais, mochila; para quando nenhum padrão tem custo reduzido
+    // negativo, quando o limite de Farley já fecha o limite inteiro ou no limite de tempo
+    PatternPricer pricer(d);
+    vector<double> duais(ITENS);
+    IloNumArray valores(env);
+    CuttingPattern novo;
+    double limite = 0, decorrido = 0;
+    while (true) {
+        if (!cplex.solve()) {
+            return false;
+        }
+        cg.rodadas++;
+        cg.lp = cplex.getObjValue();
+        cplex.getDuals(valores, demanda);
+        for (int i = 0; i < ITENS; i++) duais[i] = valores[i];
+        double valor = pricer.price(duais, novo);
+        decorrido += timer.lap();
+        if (valor <= 1 + 1e-6) {
+            // Nenhum padrão melhora: o LP restrito é o LP completo
+            limite = max(limite, cg.lp);
+            break;
+        }
+        limite = max(limite, cg.lp / valor);
+        if (ceil(limite - 1e-6) >= ceil(cg.lp - 1e-6) || ceil(limite - 1e-6) >= solucao.rolos) break;
+        if (opts.timeLimit > 0 && decorrido >= opts.timeLimit) break;
+        padroes.push_back(novo);
+        addColumn(novo);
+    }
+    cg.colunas = padroes.size();
+    cg.limite = (long long)ceil(limite - 1e-6);
+
+    cplex.getValues(valores, x);
+    vector<double> lp(padroes.size());
+    for (size_t p = 0; p < padroes.size(); p++) lp[p] = valores[p];
+    CuttingSolution arredondada = roundCutting(d, padroes, lp);
+    if (arredondada.rolos < solucao.rolos) solucao = move(arredondada);
+    cg.tempo = decorrido + timer.lap();
+    result.solveTime = cg.tempo;
+
+    // O MIP fica com o que sobrou do limite de tempo
+    ProblemOptions mipOpts = opts;
+    if (opts.timeLimit > 0) mipOpts.timeLimit = opts.timeLimit - cg.tempo;
+    if (inteiro && solucao.rolos > cg.limite && (opts.timeLimit <= 0 || mipOpts.timeLimit > 0)) {
+        // Preço-e-ramificação: MIP sobre as colunas geradas mais as da melhor solução, que
+        // entra como solução inicial
+        for (const CuttingPattern &p : solucao.padroes) {
+            padroes.push_back(p);
+            addColumn(p);
+        }
+        IloNumArray inicio(env, x.getSize());
+        for (int p = 0; p < cg.colunas; p++) inicio[p] = 0;
+        for (size_t k = 0; k < solucao.vezes.size(); k++) {
+            inicio[cg.colunas + k] = solucao.vezes[k];
+        }
+        model.add(IloConversion(env, x, ILOINT));
+        cplex.addMIPStart(x, inicio);
+        inicio.end();
+        if (!solveModel(cplex, mipOpts, result)) {
+            return false;
+        }
+        result.solveTime += cg.tempo;
+        cplex.getValues(valores, x);
+        CuttingSolution mip;
+        for (size_t p = 0; p < padroes.size(); p++) {
+            long long vezes = llround(valores[p]);
+            if (vezes <= 0) continue;
+            mip.padroes.push_back(padroes[p]);
+            mip.vezes.push_back(vezes);
+            mip.rolos += vezes;
+        }
+        if (mip.rolos < solucao.rolos) solucao = move(mip);
+    }
+    valores.end();
+
+    // O MIP restrito às colunas geradas não prova otimalidade; só o limite do LP prova
+    result.status = solucao.rolos <= cg.limite ? "Optimal" : "Feasible";
+    result.objective = solucao.rolos;
+    result.gap = (double)(solucao.rolos - cg.limite) / max(1LL, solucao.rolos);
+    return true;
+}
+
+static void printCutting(const CuttingStockData &d, const CuttingSolution &s, const ColumnGeneration &cg) {
+    cout << "Rolos = " << s.rolos << " (limite inferior " << cg.limite << ", LP " << cg.lp << ")" << endl;
+    cout << "Geração de colunas: " << cg.rodadas << " rodadas, " << cg.colunas << " padrões, " << cg.tempo << " s"
+         << endl;
+    for (size_t p = 0; p < s.padroes.size() && (int)p < MAX_DETALHES; p++) {
+        cout << "Padrão " << p + 1 << " x " << s.vezes[p] << ":";
+        for (size_t k = 0; k < s.padroes[p].itens.size(); k++) {
+            int i = s.padroes[p].itens[k];
+            cout << " " << s.padroes[p].qtd[k] << " x " << d.largura[i];
+        }
+        cout << endl;
+    }
+}
+
+// Métodos (opts.method): "cplex" (padrão, geração de colunas + MIP sobre as colunas),
+// "round" (geração de colunas + arredondamento) ou "check", que resolve pelos dois, confere
+// as soluções e os limites
+ProblemResult CuttingStockProblem(const ProblemOptions &opts) {
+    ProblemResult result;
+    IloEnv env;
+    try {
+        Timer timer;
+        // Dados: largura do rolo, larguras e demandas dos itens
+        const CuttingStockData d = loadCuttingStock(opts);
+        result.loadTime = timer.lap();
+
+        if (opts.method == "cplex" || opts.method == "round") {
+            CuttingSolution solucao;
+            ColumnGeneration cg;
+            if (!solveColumnGeneration(env, d, opts, opts.method == "cplex", result, solucao, cg)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
+            }
+            if (!opts.quiet) {
+                printCutting(d, solucao, cg);
+            }
+        }
+        else if (opts.method == "check") {
+            CuttingSolution solucao, arredondada;
+            ColumnGeneration cg, cgArredondada;
+            ProblemResult outro;
+            if (!solveColumnGeneration(env, d, opts, true, result, solucao, cg) ||
+                !solveColumnGeneration(env, d, opts, false, outro, arredondada, cgArredondada)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
+            }
+            string erro;
+            bool ok = checkCutting(d, solucao, erro) && checkCutting(d, arredondada, erro);
+            if (ok && (solucao.rolos < cg.limite || arredondada.rolos < cgArredondada.limite)) {
+                erro = "solução abaixo do limite inferior";
+                ok = false;
+            }
+            if (ok && solucao.rolos > arredondada.rolos) {
+                erro = "MIP pior que o arredondamento";
+                ok = false;
+            }
+            if (!ok) {
+                cerr << "Verificação do corte falhou: " << erro << endl;
+                result.status = "Mismatch";
+            }
+            if (!opts.quiet) {
+                printCutting(d, solucao, cg);
+                cout << "round = " << arredondada.rolos << " (limite " << cgArredondada.limite << "): "
+                     << (ok ? "ok" : erro) << endl;
+            }
+        }
+        else {
+            throw runtime_error("método desconhecido para CuttingStockProblem: " + opts.method);
+        }
+    }
+    catch (IloException& e) {
+        cerr << "Erro CPLEX: " << e << endl;
+    }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
+    catch (...) {
+        cerr << "Erro desconhecido" << endl;
+    }
+    env.end();
+    return result;
+}
@@ -1,76 +1,78 @@
 #include <ilcplex/ilocplex.h>
 #include <iostream>
+#include "Problems.hpp"
+#include "ModelBuilder.hpp"
 ILOSTLBEGIN
 
-int DietProblem() {
+ProblemResult DietProblem(const ProblemOptions &opts) {
+    ProblemResult result;
     IloEnv env;
     try {
+        Timer timer;
+        // Dados (no exemplo: vitaminas A e C, 6 ingredientes)
+        const DietData d = loadDiet(opts);
+        result.loadTime = timer.lap();
+        const int NUM_VITAMINAS = d.numNutrientes;
+        const int NUM_INGREDIENTES = d.numIngredientes;
+
         // Criar modelo
         IloModel model(env);
+        ModelBuilder mb(env, opts);
         
         // Máximo variável
         const IloInt MAX_QUANTITY = 10000;
 
-        // Constantes
-        const int NUM_VITAMINAS = 2;
-        const int NUM_INGREDIENTES = 6;
-
-        int vitaminas[NUM_VITAMINAS][NUM_INGREDIENTES] = {
-            {1, 0, 2, 2, 1, 2}, // Vitamina A
-            {0, 1, 3, 1, 3, 2}  // Vitamina C
-        };
-
-        int quantidade_minima[NUM_VITAMINAS] = { 9, 19 }; // Quantidade mínima de cada vitamina
-
-        int precos[NUM_INGREDIENTES] = { 35, 30, 60, 50, 27, 22 }; // Preço de cada ingrediente
-
-        // Variável
-        IloIntVarArray x(env, NUM_INGREDIENTES, 0, MAX_QUANTITY);
-        
-        // Nomear as variáveis
-        for (int i = 0; i < NUM_INGREDIENTES; i++) {
-            x[i].setName(("x" + std::to_string(i + 1)).c_str());
-        }
+        // Variável (com nome)
+        const int x = mb.addVars(NUM_INGREDIENTES, 0, MAX_QUANTITY, IloNumVar::Int,
+                                 [](int i) { return "x" + std::to_string(i + 1); });
 
         // Função objetivo: Minimizar custo
-        IloExpr custo(env);
         for (int i = 0; i < NUM_INGREDIENTES; i++) {
-            custo += precos[i] * x[i];
+            mb.setObjective(x + i, d.preco[i]);
         }
-        model.add(IloMinimize(env, custo));
-        custo.end();
         
         // Restrições
             // Total de cada vitamina
         for (int i = 0; i < NUM_VITAMINAS; i++) {
-            IloExpr vitamina(env);
+            const int vitamina = mb.addRow(d.minimo[i], IloInfinity);
             for (int j = 0; j < NUM_INGREDIENTES; j++) {
-                vitamina += vitaminas[i][j] * x[j];
+                double c = d.conteudo[i * NUM_INGREDIENTES + j];
+                if (c != 0) mb.addCoef(vitamina, x + j, c);
             }
-            model.add(vitamina >= quantidade_minima[i]);
-            vitamina.end();
         }
+        mb.extract(model, IloObjective::Minimize);
 
         // Resolver
         IloCplex cplex(model);
-        if (!cplex.solve()) {
+        result.buildTime = timer.lap();
+        if (!solveModel(cplex, opts, result)) {
             env.error() << "Falha ao resolver o modelo" << endl;
             throw(-1);
         }
         
-        // Resultados
-        cout << "Solução ótima = " << cplex.getObjValue() << endl;
-        cout << "Quantidade de cada ingrediente:" << endl;
-        for (int i = 0; i < NUM_INGREDIENTES; i++) {
-            cout << x[i].getName() << " = " << cplex.getValue(x[i]) << endl;
+        if (!opts.quiet) {
+            // Resultados (ingredientes usados)
+            cout << "Solução ótima = " << cplex.getObjValue() << endl;
+            cout << "Quantidade de cada ingrediente:" << endl;
+            IloNumArray valores(env);
+            cplex.getValues(valores, mb.vars());
+            for (int i = 0, mostrados = 0; i < NUM_INGREDIENTES && mostrados < MAX_DETALHES; i++) {
+                if (valores[x + i] > 0.5 || NUM_INGREDIENTES <= MAX_DETALHES) {
+                    cout << "x" << i + 1 << " = " << valores[x + i] << endl;
+                    mostrados++;
+                }
+            }
         }
     }
     catch (IloException& e) {
         cerr << "Erro CPLEX: " << e << endl;
     }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
     catch (...) {
         cerr << "Erro desconhecido" << endl;
     }
     env.end();
-    return 0;
-}
\ No newline at end of file
+    return result;
+}
@@ -0,0 +1,119 @@
+#include "Facility.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <thread>
+#include "Scheduler.hpp"
+
+using namespace std;
+
+namespace {
+
+// Blocos de clientes: uns poucos por worker, para equilibrar sem disputar a fila
+size_t blockSize(int numClientes, int workers) {
+    return max<size_t>(64, numClientes / (8 * (size_t)max(1, workers)) + 1);
+}
+
+void forBlocks(int numClientes, int workers, const function<void(int, int)> &run) {
+    const size_t bloco = blockSize(numClientes, workers);
+    const size_t blocos = (numClientes + bloco - 1) / bloco;
+    runConcurrent(blocos, workers, [&](size_t b) {
+        run(b * bloco, min<size_t>(numClientes, (b + 1) * bloco));
+    });
+}
+
+}  // namespace
+
+FacilityBenders::FacilityBenders(const FacilityData &d, int workers)
+    : d(d), numWorkers(workers > 0 ? workers : max(1u, thread::hardware_concurrency())) {
+    const int m = d.numCentros, n = d.numClientes;
+    ordem.resize((size_t)m * n);
+    custoOrdenado.resize((size_t)m * n);
+    forBlocks(n, numWorkers, [&](int de, int ate) {
+        for (int j = de; j < ate; j++) {
+            int *o = &ordem[(size_t)j * m];
+            iota(o, o + m, 0);
+            sort(o, o + m, [&](int a, int b) {
+                double ca = d.custoAtendimento[(size_t)a * n + j], cb = d.custoAtendimento[(size_t)b * n + j];
+                return ca != cb ? ca < cb : a < b;
+            });
+            for (int k = 0; k < m; k++) custoOrdenado[(size_t)j * m + k] = d.custoAtendimento[(size_t)o[k] * n + j];
+        }
+    });
+}
+
+double FacilityBenders::evaluate(const vector<double> &x, vector<double> &custos, vector<BendersCut> &cortes,
+                                 int workers) const {
+    const int m = d.numCentros, n = d.numClientes;
+    custos.resize(n);
+    cortes.resize(n);
+    forBlocks(n, workers > 0 ? workers : numWorkers, [&](int de, int ate) {
+        for (int j = de; j < ate; j++) {
+            const int *o = &ordem[(size_t)j * m];
+            const double *c = &custoOrdenado[(size_t)j * m];
+            // Centro crítico: o primeiro em que a abertura acumulada chega a 1
+            double acumulado = 0, custo = 0;
+            int k = 0;
+            for (; k < m - 1; k++) {
+                double xi = min(1.0, max(0.0, x[o[k]]));
+                if (acumulado + xi >= 1 - 1e-9) break;
+                acumulado += xi;
+                custo += xi * c[k];
+            }
+            const double critico = c[k];
+            custos[j] = custo + (1 - acumulado) * critico;
+
+            BendersCut &corte = cortes[j];
+            corte.constant = critico;
+            corte.centers.clear();
+            corte.coefs.clear();
+            for (int t = 0; t < m && c[t] < critico; t++) {
+                corte.centers.push_back(o[t]);
+                corte.coefs.push_back(critico - c[t]);
+            }
+        }
+    });
+    double total = 0;
+    for (double c : custos) total += c;
+    return total;
+}
+
+vector<double> FacilityBenders::cheapest() const {
+    const int m = d.numCentros, n = d.numClientes;
+    vector<double> menor(n);
+    for (int j = 0; j < n; j++) menor[j] = custoOrdenado[(size_t)j * m];
+    return menor;
+}
+
+vector<int> FacilityBenders::assign(const vector<double> &x) const {
+    const int m = d.numCentros, n = d.numClientes;
+    vector<int> atendimento(n, -1);
+    for (int j = 0; j < n; j++) {
+        const int *o = &ordem[(size_t)j * m];
+        for (int k = 0; k < m; k++) {
+            if (x[o[k]] > 0.5) {
+                atendimento[j] = o[k];
+                break;
+            }
+        }
+    }
+    return atendimento;
+}
+
+bool checkFacility(const FacilityData &d, const vector<double> &x, const vector<int> &atendimento, double &custo,
+                   string &erro) {
+    custo = 0;
+    for (int i = 0; i < d.numCentros; i++) {
+        if (x[i] > 0.5) custo += d.custoInstalacao[i];
+    }
+    for (int j = 0; j < d.numClientes; j++) {
+        int i = atendimento[j];
+        if (i < 0 || i >= d.numCentros || x[i] < 0.5) {
+            erro = "cliente " + to_string(j + 1) + " sem centro aberto";
+            return false;
+        }
+        custo += d.custoAtendimento[(size_t)i * d.numClientes + j];
+    }
+    return true;
+}
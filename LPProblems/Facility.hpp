@@ -0,0 +1,57 @@
+// LPProblems/Facility.hpp
+// Subproblemas de Benders do FacilityProblem (sem CPLEX).
+//
+// Com as aberturas x fixadas (inteiras ou fracionárias, desde que sum x >= 1), o atendimento
+// se separa por cliente: min sum_i c_ij y_ij com sum_i y_ij = 1 e 0 <= y_ij <= x_i. A
+// solução é gulosa na ordem de custo do cliente até acumular 1 de abertura; o custo c_kj do
+// centro crítico k é o dual da restrição de atendimento, e o corte
+//     theta_j >= c_kj - sum_i max(0, c_kj - c_ij) x_i
+// vale para todo x e é exato no ponto avaliado. Só os centros mais baratos que o crítico
+// entram no corte.
+//
+// A ordem de custo de cada cliente é calculada uma vez e guardada com os custos nessa ordem,
+// contíguos por cliente; os clientes são avaliados em blocos contíguos distribuídos entre
+// os workers (runConcurrent), sem estado compartilhado além da saída de cada cliente.
+#ifndef FACILITY_HPP
+#define FACILITY_HPP
+#include <string>
+#include <vector>
+#include "Instances.hpp"
+
+// Corte de um cliente: theta >= constant - sum_k coefs[k] * x[centers[k]]
+struct BendersCut {
+    double constant = 0;
+    std::vector<int> centers;
+    std::vector<double> coefs;
+};
+
+class FacilityBenders {
+public:
+    FacilityBenders(const FacilityData &d, int workers = 0);
+
+    // Custo de atendimento de cada cliente em x e o corte de cada um; devolve a soma dos
+    // custos. "workers": 0 usa o valor do construtor.
+    double evaluate(const std::vector<double> &x, std::vector<double> &custos, std::vector<BendersCut> &cortes,
+                    int workers = 0) const;
+
+    // Menor custo de atendimento de cada cliente (limite inferior de theta_j)
+    std::vector<double> cheapest() const;
+
+    // Cliente j no centro aberto (x > 0,5) mais barato; -1 se nenhum está aberto
+    std::vector<int> assign(const std::vector<double> &x) const;
+
+    int workers() const { return numWorkers; }
+
+private:
+    const FacilityData &d;
+    std::vector<int> ordem;             // Centros de cada cliente em ordem crescente de custo
+    std::vector<double> custoOrdenado;  // Custos nessa ordem, contíguos por cliente
+    int numWorkers;
+};
+
+// Custo total (instalação + atendimento) de uma atribuição; false se ela usa um centro
+// fechado ou deixa cliente sem centro
+bool checkFacility(const FacilityData &d, const std::vector<double> &x, const std::vector<int> &atendimento,
+                   double &custo, std::string &erro);
+
+#endif
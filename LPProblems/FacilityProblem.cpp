@@ -1,94 +1,414 @@
 #include <ilcplex/ilocplex.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <utility>
+#include <vector>
+#include <iostream>
+#include <stdexcept>
+#include "Problems.hpp"
+#include "Facility.hpp"
+#include "ModelBuilder.hpp"
 ILOSTLBEGIN
 
-int FacilityProblem() {
-    IloEnv env;
-    try {
-        // Criar modelo
-        IloModel model(env);
-        
-        // Constantes
-        const int CENTROS = 3;
-        const int CLIENTES = 4;
-        const int CUSTO_INSTALACAO[CENTROS] = {100, 150, 120};
-        const int CUSTO_ATENDIMENTO[CENTROS][CLIENTES]= {
-            {20, 104, 11, 325},
-        	{28, 104, 325, 8},
-        	{325, 5, 5, 96}
-        };
-        // Variáveis de decisão
-        IloIntVarArray x(env, CENTROS, 0, 1); // Variável binária para indicar se o centro é aberto
-        IloArray <IloIntVarArray> y(env, CENTROS); // Variável binária para indicar se o cliente é atendido pelo centro
-        for (int i = 0; i < CENTROS; i++) {
-            y[i] = IloIntVarArray(env, CLIENTES);
-            for (int j = 0; j < CLIENTES; j++) {
-                y[i][j] = IloIntVar(env, 0, 1);
+// Separa as ligações y[i][j] <= x[i] violadas pela relaxação do nó e as devolve como cortes
+// de usuário globais. O modelo de partida só tem a ligação agregada por centro, que já basta
+// para as soluções inteiras: os cortes apenas apertam a relaxação, sem que o CPLEX precise
+// guardar as CENTROS x CLIENTES linhas desde o início. Com x[i] fracionário quase todas as
+// ligações ficam violadas, então cada rodada entra só com as MAX_POR_CENTRO mais violadas de
+// cada centro, e só nos nós até a profundidade MAX_PROFUNDIDADE; as rodadas seguintes do
+// mesmo nó pegam as próximas. Variáveis como no ModelBuilder: x[i] em vars[x + i] e y[i][j]
+// em vars[y + i * clientes + j].
+class LinkingCallback : public IloCplex::Callback::Function {
+public:
+    LinkingCallback(const IloNumVarArray &vars, int x, int y, int centros, int clientes)
+        : vars(vars), x(x), y(y), centros(centros), clientes(clientes) {}
+
+    void invoke(const IloCplex::Callback::Context &context) override {
+        if (!context.inRelaxation()) return;
+        if (context.getLongInfo(IloCplex::Callback::Context::Info::NodeDepth) > MAX_PROFUNDIDADE) return;
+        IloEnv env = context.getEnv();
+        IloNumArray val(env);
+        context.getRelaxationPoint(vars, val);
+        vector<pair<double, int>> violadas;  // (violação, cliente)
+        for (int i = 0; i < centros; i++) {
+            violadas.clear();
+            for (int j = 0; j < clientes; j++) {
+                const double violacao = val[y + i * clientes + j] - val[x + i];
+                if (violacao > EPS) violadas.push_back({violacao, j});
+            }
+            if ((int)violadas.size() > MAX_POR_CENTRO) {
+                nth_element(violadas.begin(), violadas.begin() + MAX_POR_CENTRO, violadas.end(),
+                            greater<pair<double, int>>());
+                violadas.resize(MAX_POR_CENTRO);
+            }
+            for (const auto &v : violadas) {
+                const int yij = y + i * clientes + v.second;
+                IloRange corte(env, -IloInfinity, vars[yij] - vars[x + i], 0);
+                context.addUserCut(corte, IloCplex::UseCutPurge, IloFalse);
+                corte.end();
+                cortes++;
             }
         }
-        
-        // Função Objetivo
-        IloExpr custo_instalacao_total(env);
+        val.end();
+    }
+
+    long long cuts() const { return cortes; }
+
+private:
+    static constexpr double EPS = 1e-6;
+    static constexpr int MAX_POR_CENTRO = 10;
+    static constexpr int MAX_PROFUNDIDADE = 3;
+    IloNumVarArray vars;
+    int x, y, centros, clientes;
+    std::atomic<long long> cortes{0};
+};
+
+// "lazy": ligação agregada sum_j y[i][j] <= CLIENTES * x[i] no modelo e as desagregadas pelo
+// callback; caso contrário, todas as CENTROS x CLIENTES ligações desde o início. Devolve o
+// centro de cada cliente em "atendimento".
+static bool solveCplex(IloEnv env, const FacilityData &d, const ProblemOptions &opts, bool lazy,
+                       ProblemResult &result, vector<int> &atendimento) {
+    Timer timer;
+    const int CENTROS = d.numCentros;
+    const int CLIENTES = d.numClientes;
+    // Memória do modelo: pico acima da memória residente no início da construção (com o pico
+    // do processo zerado, o modelo resolvido antes no "check" não conta)
+    const bool picoZerado = resetPeakMemory();
+    const long long memoriaInicial = residentMemoryKB();
+
+    // Criar modelo
+    IloModel model(env);
+    ModelBuilder mb(env, opts);
+
+    // Variáveis de decisão
+    const int x = mb.addVars(CENTROS, 0, 1, IloNumVar::Int); // Variável binária para indicar se o centro é aberto
+    // Variável binária para indicar se o cliente é atendido pelo centro: y[i][j] em y + i * CLIENTES + j
+    const int y = mb.addVars(CENTROS * CLIENTES, 0, 1, IloNumVar::Int);
+
+    // Função Objetivo
+    for (int i = 0; i < CENTROS; i++) {
+        mb.setObjective(x + i, d.custoInstalacao[i]);
+        for (int j = 0; j < CLIENTES; j++){
+            mb.setObjective(y + i * CLIENTES + j, d.custoAtendimento[i * CLIENTES + j]);
+        }
+    }
+
+    // Restrições
+    // Cada cliente deve ser atendido por exatamente um centro
+    for (int j = 0; j < CLIENTES; j++) {
+        const int soma = mb.addRow(1, 1);
         for (int i = 0; i < CENTROS; i++) {
-            custo_instalacao_total += x[i] * CUSTO_INSTALACAO[i];
+            mb.addCoef(soma, y + i * CLIENTES + j, 1);
         }
-        IloExpr custo_atendimento_total(env);
+    }
+    // Um centro pode atender um cliente apenas se estiver aberto
+    if (lazy) {
         for (int i = 0; i < CENTROS; i++) {
-            for (int j = 0; j < CLIENTES; j++){
-                custo_atendimento_total += y[i][j] * CUSTO_ATENDIMENTO[i][j];
+            const int ligacao = mb.addRow(-IloInfinity, 0);
+            for (int j = 0; j < CLIENTES; j++) {
+                mb.addCoef(ligacao, y + i * CLIENTES + j, 1);
             }
+            mb.addCoef(ligacao, x + i, -(IloNum)CLIENTES);
         }
-        model.add(IloMinimize(env, custo_instalacao_total + custo_atendimento_total));
-        custo_instalacao_total.end();
-        custo_atendimento_total.end();
-        
-        // Restrições
-        // Cada cliente deve ser atendido por exatamente um centro
+    }
+    else {
+        for (int i = 0; i < CENTROS; i++) {
+            for (int j = 0; j < CLIENTES; j++) {
+                const int ligacao = mb.addRow(-IloInfinity, 0);
+                mb.addCoef(ligacao, y + i * CLIENTES + j, 1);
+                mb.addCoef(ligacao, x + i, -1);
+            }
+        }
+    }
+    mb.extract(model, IloObjective::Minimize);
+
+    // Resolver
+    IloCplex cplex(model);
+    LinkingCallback ligacao(mb.vars(), x, y, CENTROS, CLIENTES);
+    if (lazy) {
+        cplex.use(&ligacao, IloCplex::Callback::Context::Id::Relaxation);
+    }
+    result.buildTime = timer.lap();
+    if (!opts.quiet) {
+        cout << "Modelo " << (lazy ? "agregado" : "completo") << ": " << cplex.getNrows() << " restrições, "
+             << cplex.getNNZs() << " não nulos" << endl;
+    }
+    if (!solveModel(cplex, opts, result)) {
+        return false;
+    }
+    if (!opts.quiet && lazy) {
+        cout << "Ligações adicionadas pelo callback: " << ligacao.cuts() << endl;
+    }
+    const long long pico = peakMemoryKB();
+    if (!opts.quiet && pico >= 0 && memoriaInicial >= 0) {
+        if (picoZerado) {
+            cout << "Memória (construção + resolução): pico de " << (pico - memoriaInicial) / 1024 << " MB" << endl;
+        }
+        else {
+            cout << "Memória: pico do processo de " << pico / 1024 << " MB" << endl;
+        }
+    }
+
+    atendimento.assign(CLIENTES, -1);
+    IloNumArray valores(env);
+    cplex.getValues(valores, mb.vars());
+    for (int i = 0; i < CENTROS; i++) {
+        if (valores[x + i] < 0.5) continue;
         for (int j = 0; j < CLIENTES; j++) {
-            IloExpr soma(env);
-            for (int i = 0; i < CENTROS; i++) {
-                soma += y[i][j];
+            if (valores[y + i * CLIENTES + j] > 0.5) atendimento[j] = i;
+        }
+    }
+    valores.end();
+    return true;
+}
+
+// Cortes de Benders dos subproblemas por cliente (Facility.hpp). Nos candidatos inteiros do
+// mestre, rejeita os que subestimam o custo de atendimento; nas relaxações, adiciona os
+// mesmos cortes como cortes de usuário. Com um theta por cliente (multi-corte) sai um corte
+// por cliente violado; com um theta só (agregado), a soma dos cortes de todos.
+// O mestre roda com uma thread do CPLEX: o paralelismo fica nos workers do subproblema, e o
+// estado abaixo não é compartilhado entre chamadas simultâneas.
+class BendersCallback : public IloCplex::Callback::Function {
+public:
+    BendersCallback(const FacilityBenders &benders, const IloIntVarArray &x, const IloNumVarArray &theta)
+        : benders(benders), x(x), theta(theta) {}
+
+    void invoke(const IloCplex::Callback::Context &context) override {
+        const bool candidato = context.inCandidate();
+        if (candidato ? !context.isCandidatePoint() : !context.inRelaxation()) return;
+        IloEnv env = context.getEnv();
+        IloNumArray xVal(env), thetaVal(env);
+        if (candidato) {
+            context.getCandidatePoint(x, xVal);
+            context.getCandidatePoint(theta, thetaVal);
+        }
+        else {
+            context.getRelaxationPoint(x, xVal);
+            context.getRelaxationPoint(theta, thetaVal);
+        }
+        vector<double> ponto(xVal.getSize());
+        for (IloInt i = 0; i < xVal.getSize(); i++) ponto[i] = xVal[i];
+
+        Timer timer;
+        const double total = benders.evaluate(ponto, custos, cortes);
+        tempo += timer.lap();
+        avaliacoes++;
+
+        IloRangeArray violados(env);
+        if (theta.getSize() == 1) {
+            if (total > thetaVal[0] + 1e-6 * max(1.0, total)) {
+                vector<double> coef(ponto.size(), 0);
+                double constante = 0;
+                for (const BendersCut &corte : cortes) {
+                    constante += corte.constant;
+                    for (size_t k = 0; k < corte.centers.size(); k++) coef[corte.centers[k]] += corte.coefs[k];
+                }
+                IloExpr expr(env);
+                expr += theta[0];
+                for (size_t i = 0; i < coef.size(); i++) {
+                    if (coef[i] != 0) expr += coef[i] * x[i];
+                }
+                violados.add(expr >= constante);
+                expr.end();
             }
-            model.add(soma == 1);
-            soma.end();
         }
-        // Um centro pode atender um cliente apenas se estiver aberto
-        for (int i = 0; i < CENTROS; i++) {
-            for (int j = 0; j < CLIENTES; j++) {
-                model.add(y[i][j] <= x[i]);
+        else {
+            for (size_t j = 0; j < cortes.size(); j++) {
+                if (custos[j] <= thetaVal[j] + 1e-6 * max(1.0, custos[j])) continue;
+                const BendersCut &corte = cortes[j];
+                IloExpr expr(env);
+                expr += theta[j];
+                for (size_t k = 0; k < corte.centers.size(); k++) expr += corte.coefs[k] * x[corte.centers[k]];
+                violados.add(expr >= corte.constant);
+                expr.end();
             }
         }
+        if (violados.getSize() > 0) {
+            if (candidato) {
+                context.rejectCandidate(violados);
+            }
+            else {
+                for (IloInt k = 0; k < violados.getSize(); k++) {
+                    context.addUserCut(violados[k], IloCplex::UseCutPurge, IloFalse);
+                }
+            }
+            numCortes += violados.getSize();
+        }
+        violados.endElements();
+        violados.end();
+        xVal.end();
+        thetaVal.end();
+    }
 
+    long long numCortes = 0;
+    long long avaliacoes = 0;
+    double tempo = 0;  // Segundos nos subproblemas
 
-        // Resolver
-        IloCplex cplex(model);
-        if (!cplex.solve()) {
-            env.error() << "Falha ao resolver o modelo" << endl;
-            throw(-1);
+private:
+    const FacilityBenders &benders;
+    IloIntVarArray x;
+    IloNumVarArray theta;
+    vector<double> custos;
+    vector<BendersCut> cortes;
+};
+
+// Benders: o mestre escolhe os centros (x) e estima o atendimento por theta, limitado de
+// baixo pelo centro mais barato de cada cliente; o callback acrescenta os cortes. Workers
+// do subproblema: opts.threads, ou todos os núcleos.
+static bool solveBenders(IloEnv env, const FacilityData &d, const ProblemOptions &opts, bool agregado,
+                         ProblemResult &result, vector<int> &atendimento) {
+    Timer timer;
+    const int CENTROS = d.numCentros;
+    const int CLIENTES = d.numClientes;
+    FacilityBenders benders(d, opts.threads);
+    const vector<double> menor = benders.cheapest();
+
+    // Criar modelo mestre
+    IloModel model(env);
+    IloIntVarArray x(env, CENTROS, 0, 1);
+    IloNumVarArray theta(env);
+    if (agregado) {
+        double soma = 0;
+        for (double c : menor) soma += c;
+        theta.add(IloNumVar(env, soma, IloInfinity));
+    }
+    else {
+        for (int j = 0; j < CLIENTES; j++) {
+            theta.add(IloNumVar(env, menor[j], IloInfinity));
         }
-        
-        // Resultados
-        cout << "Solução ótima = " << cplex.getObjValue() << endl;
-        cout << "Centros abertos: " << endl;
-        for (int i = 0; i < CENTROS; i++) {
-            if (cplex.getValue(x[i]) > 0.5) {
-                cout << "Centro " << i + 1 << " aberto" << endl;
-                for (int j = 0; j < CLIENTES; j++) {
-                    if (cplex.getValue(y[i][j]) > 0.5) {
-                        cout << "\tCliente " << j + 1 << " atendido pelo centro " << i + 1 << endl;
-                    }
+    }
+    IloExpr obj(env);
+    for (int i = 0; i < CENTROS; i++) {
+        obj += d.custoInstalacao[i] * x[i];
+    }
+    obj += IloSum(theta);
+    model.add(IloMinimize(env, obj));
+    obj.end();
+    // Pelo menos um centro aberto: todo subproblema fica viável
+    model.add(IloSum(x) >= 1);
+
+    // Resolver
+    IloCplex cplex(model);
+    BendersCallback callback(benders, x, theta);
+    cplex.use(&callback, IloCplex::Callback::Context::Id::Candidate | IloCplex::Callback::Context::Id::Relaxation);
+    result.buildTime = timer.lap();
+    ProblemOptions mestre = opts;
+    mestre.threads = 1;
+    if (!solveModel(cplex, mestre, result)) {
+        return false;
+    }
+    if (!opts.quiet) {
+        cout << "Benders " << (agregado ? "agregado" : "multi-corte") << ": " << callback.numCortes << " cortes, "
+             << callback.avaliacoes << " avaliações dos subproblemas em " << callback.tempo << " s ("
+             << benders.workers() << " workers)" << endl;
+    }
+
+    IloNumArray valores(env);
+    cplex.getValues(x, valores);
+    vector<double> abertos(CENTROS);
+    for (int i = 0; i < CENTROS; i++) abertos[i] = valores[i];
+    valores.end();
+    atendimento = benders.assign(abertos);
+    return true;
+}
+
+// Resolve pelo método indicado ("cplex", "lazy", "benders" ou "benders-agg")
+static bool solveMethod(IloEnv env, const FacilityData &d, const ProblemOptions &opts, const string &method,
+                        ProblemResult &result, vector<int> &atendimento) {
+    if (method == "benders" || method == "benders-agg") {
+        return solveBenders(env, d, opts, method == "benders-agg", result, atendimento);
+    }
+    return solveCplex(env, d, opts, method == "lazy", result, atendimento);
+}
+
+static void printFacility(const FacilityData &d, double valor, const vector<int> &atendimento) {
+    cout << "Solução ótima = " << valor << endl;
+    cout << "Centros abertos: " << endl;
+    vector<vector<int>> clientes(d.numCentros);
+    for (int j = 0; j < d.numClientes; j++) {
+        if (atendimento[j] >= 0) clientes[atendimento[j]].push_back(j);
+    }
+    int mostrados = 0;
+    for (int i = 0; i < d.numCentros; i++) {
+        if (clientes[i].empty()) continue;
+        cout << "Centro " << i + 1 << " aberto" << endl;
+        for (int j : clientes[i]) {
+            if (mostrados++ >= MAX_DETALHES) break;
+            cout << "\tCliente " << j + 1 << " atendido pelo centro " << i + 1 << endl;
+        }
+    }
+}
+
+// Métodos (opts.method): "cplex" (padrão, todas as ligações no modelo), "lazy" (ligação
+// agregada + cortes por callback), "benders" (um theta por cliente), "benders-agg" (um theta
+// só) ou "check", que resolve pelo modelo completo e pelos demais e compara os custos
+ProblemResult FacilityProblem(const ProblemOptions &opts) {
+    ProblemResult result;
+    IloEnv env;
+    try {
+        Timer timer;
+        // Dados
+        const FacilityData d = loadFacility(opts);
+        result.loadTime = timer.lap();
+
+        if (opts.method == "cplex" || opts.method == "lazy" || opts.method == "benders" ||
+            opts.method == "benders-agg") {
+            vector<int> atendimento;
+            if (!solveMethod(env, d, opts, opts.method, result, atendimento)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
+            }
+            if (!opts.quiet) {
+                printFacility(d, result.objective, atendimento);
+            }
+        }
+        else if (opts.method == "check") {
+            vector<int> atendimento;
+            if (!solveMethod(env, d, opts, "cplex", result, atendimento)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
+            }
+            if (!opts.quiet) {
+                printFacility(d, result.objective, atendimento);
+                cout << "Completo = " << result.objective << " (construção " << result.buildTime << " s, resolução "
+                     << result.solveTime << " s)" << endl;
+            }
+            for (const string method : {"lazy", "benders", "benders-agg"}) {
+                ProblemResult outro;
+                vector<int> outroAtendimento;
+                if (!solveMethod(env, d, opts, method, outro, outroAtendimento)) {
+                    env.error() << "Falha ao resolver o modelo" << endl;
+                    throw(-1);
+                }
+                // Os custos só são comparáveis quando os dois provaram a otimalidade
+                bool ok = result.status != "Optimal" || outro.status != "Optimal" ||
+                          fabs(result.objective - outro.objective) <= 1e-6 * max(1.0, fabs(result.objective));
+                if (!ok) {
+                    cerr << "Verificação da localização falhou (" << method << "): custos " << result.objective
+                         << " e " << outro.objective << endl;
+                    result.status = "Mismatch";
+                }
+                if (!opts.quiet) {
+                    cout << method << " = " << outro.objective << " (construção " << outro.buildTime
+                         << " s, resolução " << outro.solveTime << " s): " << (ok ? "ok" : "custos diferentes")
+                         << endl;
                 }
             }
         }
-        
-        
-        
+        else {
+            throw runtime_error("método desconhecido para FacilityProblem: " + opts.method);
+        }
     }
     catch (IloException& e) {
         cerr << "Erro CPLEX: " << e << endl;
     }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
     catch (...) {
         cerr << "Erro desconhecido" << endl;
     }
     env.end();
-    return 0;
-}
\ No newline at end of file
+    return result;
+}
@@ -1,71 +1,231 @@
 #include <ilcplex/ilocplex.h>
+#include <algorithm>
 #include <vector>
 #include <iostream>
+#include <stdexcept>
+#include "Problems.hpp"
+#include "Coloring.hpp"
+#include "ModelBuilder.hpp"
 ILOSTLBEGIN
 
-struct Edge {
-    int from;
-    int to;
-};
+// Modelo de atribuição: x[v][c] = 1 se a antena v usa a frequência c, w[c] = 1 se a
+// frequência c é usada. Só existem as K frequências da coloração heurística (limite
+// superior), que também entra como solução inicial do MIP.
+// Quebra de simetria: a clique do limite inferior tem as cores fixadas (o vértice k da
+// clique usa a cor k) e as frequências são usadas em ordem (w[c] >= w[c + 1]).
+static bool solveCplex(IloEnv env, const Graph &g, const ColoringResult &heuristica, const ProblemOptions &opts,
+                       ProblemResult &result, vector<int> &cor) {
+    Timer timer;
+    const int NUM_NOS = g.n;
+    const int NUM_CORES = heuristica.colors;
+    const vector<int> &clique = heuristica.clique;
 
-int FrequencyProblem() {
-    IloEnv env;
-    try {
-        // Criar modelo
-        IloModel model(env);
+    // Renumera as cores da heurística para coincidir com a fixação da clique
+    vector<int> troca(NUM_CORES, -1);
+    vector<char> livre(NUM_CORES, 1);
+    for (size_t k = 0; k < clique.size(); k++) {
+        troca[heuristica.color[clique[k]]] = k;
+        livre[k] = 0;
+    }
+    for (int c = 0, proxima = 0; c < NUM_CORES; c++) {
+        if (troca[c] >= 0) continue;
+        while (!livre[proxima]) proxima++;
+        troca[c] = proxima;
+        livre[proxima] = 0;
+    }
 
-        //Constantes
-        const std::vector<Edge> EDGES = {
-            {0, 1}, {0, 2}, {0, 3}, {0, 4},
-            {1, 2}, {1, 3}, {1, 4},
-            {2, 3}, {2, 4},
-            {3, 4}
-        };
-        const int NUM_NOS = 5;
+    // Criar modelo
+    IloModel model(env);
+    ModelBuilder mb(env, opts);
+
+    // Variáveis de decisão: x[v][c] em x + v * NUM_CORES + c
+    const int x = mb.addVars(NUM_NOS * NUM_CORES, 0, 1, IloNumVar::Int, [&](int k) {
+        return "x" + std::to_string(k / NUM_CORES + 1) + "_" + std::to_string(k % NUM_CORES + 1);
+    });
+    const int w = mb.addVars(NUM_CORES, 0, 1, IloNumVar::Int, [](int c) { return "w" + std::to_string(c + 1); });
+
+    // Função objetivo: minimizar o número de frequências usadas
+    for (int c = 0; c < NUM_CORES; c++) {
+        mb.setObjective(w + c, 1);
+    }
 
-        // Variáveis de decisão
-        // Cor de cada vértice
-        IloIntVarArray x(env, NUM_NOS, 1, NUM_NOS);
-        for (int i = 0; i < NUM_NOS; i++) {
-            x[i].setName(("Frequência da antena " + std::to_string(i) + ": ").c_str());
+    // Restrições
+    // Cada antena recebe exatamente uma frequência
+    vector<int> grau(NUM_NOS, 0);
+    for (const auto &edge : g.edges) {
+        grau[edge.from]++;
+        grau[edge.to]++;
+    }
+    for (int v = 0; v < NUM_NOS; v++) {
+        const int uma = mb.addRow(1, 1);
+        for (int c = 0; c < NUM_CORES; c++) {
+            mb.addCoef(uma, x + v * NUM_CORES + c, 1);
+        }
+        // Antenas isoladas: a frequência também precisa estar em uso
+        if (grau[v] == 0) {
+            for (int c = 0; c < NUM_CORES; c++) {
+                const int uso = mb.addRow(-IloInfinity, 0);
+                mb.addCoef(uso, x + v * NUM_CORES + c, 1);
+                mb.addCoef(uso, w + c, -1);
+            }
+        }
+    }
+    // Antenas vizinhas não usam a mesma frequência, e só frequências em uso
+    for (const auto &edge : g.edges) {
+        if (edge.from == edge.to) continue;
+        for (int c = 0; c < NUM_CORES; c++) {
+            const int vizinhas = mb.addRow(-IloInfinity, 0);
+            mb.addCoef(vizinhas, x + edge.from * NUM_CORES + c, 1);
+            mb.addCoef(vizinhas, x + edge.to * NUM_CORES + c, 1);
+            mb.addCoef(vizinhas, w + c, -1);
         }
-        // Variável para o número de cores
-        IloIntVar numCores(env, 1, NUM_NOS);
-        numCores.setName("Número de frequências: ");
+    }
+    // Quebra de simetria
+    for (size_t k = 0; k < clique.size(); k++) {
+        mb.setBounds(x + clique[k] * NUM_CORES + k, 1, 1);
+    }
+    for (int c = 0; c + 1 < NUM_CORES; c++) {
+        const int ordem = mb.addRow(0, IloInfinity);
+        mb.addCoef(ordem, w + c, 1);
+        mb.addCoef(ordem, w + c + 1, -1);
+    }
+    mb.extract(model, IloObjective::Minimize);
 
-        // Função objetivo: minimizar o número de cores
-        model.add(IloMinimize(env, numCores));
-        
-        // Restrições: cada vértice deve ter uma cor diferente de seus vizinhos
-        for (const auto& edge : EDGES) {
-            model.add(x[edge.from] != x[edge.to]);
+    // Resolver, partindo da coloração heurística
+    IloCplex cplex(model);
+    IloNumArray inicioVals(env, mb.numVars());
+    for (int v = 0; v < NUM_NOS; v++) {
+        for (int c = 0; c < NUM_CORES; c++) {
+            inicioVals[x + v * NUM_CORES + c] = troca[heuristica.color[v]] == c ? 1 : 0;
         }
-        // numCores tem que ser maior ou igual ao número de qualquer cor
-        for (int i = 0; i < NUM_NOS; i++) {
-            model.add(numCores >= x[i]);
+    }
+    for (int c = 0; c < NUM_CORES; c++) {
+        inicioVals[w + c] = 1;
+    }
+    cplex.addMIPStart(mb.vars(), inicioVals);
+    inicioVals.end();
+    result.buildTime = timer.lap();
+    if (!solveModel(cplex, opts, result)) {
+        return false;
+    }
+    IloNumArray valores(env);
+    cplex.getValues(valores, mb.vars());
+    cor.assign(NUM_NOS, 0);
+    for (int v = 0; v < NUM_NOS; v++) {
+        for (int c = 0; c < NUM_CORES; c++) {
+            if (valores[x + v * NUM_CORES + c] > 0.5) cor[v] = c;
         }
-        
-        // Resolver
-        IloCplex cplex(model);
-        if (!cplex.solve()) {
-            env.error() << "Falha ao resolver o modelo" << endl;
-            throw(-1);
+    }
+    valores.end();
+    return true;
+}
+
+static void printColoring(double numCores, const vector<int> &cor) {
+    cout << "Solução ótima = " << numCores << endl;
+    cout << "Número de frequências: " << numCores << endl;
+    for (int i = 0; i < (int)cor.size() && i < MAX_DETALHES; i++) {
+        cout << "Frequência da antena " << i << ": " << cor[i] + 1 << endl;
+    }
+}
+
+// Métodos (opts.method): "cplex" (padrão, com a heurística como solução inicial e limite
+// superior), "dsatur" (só a heurística construtiva), "tabucol" (DSATUR + tabucol + limite
+// inferior da clique) ou "check", que compara o tabucol com o CPLEX. Em "cplex" e "check"
+// o CPLEX não roda quando a clique já prova que a coloração da heurística é ótima.
+ProblemResult FrequencyProblem(const ProblemOptions &opts) {
+    ProblemResult result;
+    IloEnv env;
+    try {
+        Timer timer;
+        // Dados: antenas vizinhas (arestas) não podem usar a mesma frequência
+        const Graph g = loadFrequencyGraph(opts);
+        result.loadTime = timer.lap();
+
+        if (opts.method == "dsatur") {
+            vector<int> cor = dsatur(g);
+            result.solveTime = timer.lap();
+            int numCores = 0;
+            for (int c : cor) numCores = max(numCores, c + 1);
+            result.status = "Feasible";
+            result.objective = numCores;
+            if (!opts.quiet) {
+                printColoring(numCores, cor);
+            }
+        }
+        else if (opts.method == "tabucol" || opts.method == "check" || opts.method == "cplex") {
+            // Heurística: limite superior, solução inicial e clique do limite inferior
+            // (com o CPLEX, fica com um quarto do limite de tempo)
+            double limite = opts.method == "tabucol" ? opts.timeLimit : opts.timeLimit / 4;
+            ColoringResult heuristica = colorGraph(g, limite, opts.seed);
+            double tempoHeuristica = timer.lap();
+            if (opts.method == "tabucol") {
+                result.solveTime = tempoHeuristica;
+                result.status = heuristica.optimal() ? "Optimal" : "Feasible";
+                result.objective = heuristica.colors;
+                result.gap = (double)(heuristica.colors - (int)heuristica.clique.size()) / heuristica.colors;
+                if (!opts.quiet) {
+                    printColoring(heuristica.colors, heuristica.color);
+                }
+            }
+            else {
+                vector<int> cor;
+                if (heuristica.optimal()) {
+                    // Tantas cores quanto a clique tem vértices: a coloração já é ótima
+                    cor = heuristica.color;
+                    result.solveTime = tempoHeuristica;
+                    result.status = "Optimal";
+                    result.objective = heuristica.colors;
+                    result.gap = 0;
+                }
+                else {
+                    if (!solveCplex(env, g, heuristica, opts, result, cor)) {
+                        env.error() << "Falha ao resolver o modelo" << endl;
+                        throw(-1);
+                    }
+                    result.buildTime += tempoHeuristica;
+                }
+                if (opts.method == "check") {
+                    string erro;
+                    bool ok = checkColoring(g, heuristica.color, heuristica.colors, erro);
+                    if (ok && (IloRound(result.objective) > heuristica.colors ||
+                               IloRound(result.objective) < (int)heuristica.clique.size())) {
+                        ok = false;
+                        erro = "ótimo do CPLEX fora dos limites da heurística";
+                    }
+                    if (!ok) {
+                        cerr << "Verificação da coloração falhou: " << erro << endl;
+                        result.status = "Mismatch";
+                    }
+                    if (!opts.quiet) {
+                        cout << "Tabucol = " << heuristica.colors << " (" << tempoHeuristica << " s), clique = "
+                             << heuristica.clique.size();
+                        if (heuristica.optimal()) cout << ", ótima sem o CPLEX";
+                        else cout << ", CPLEX = " << result.objective << " (" << result.solveTime << " s)";
+                        cout << ": " << (ok ? "ok" : erro) << endl;
+                    }
+                }
+                if (!opts.quiet) {
+                    printColoring(result.objective, cor);
+                }
+            }
+            if (!opts.quiet) {
+                cout << "DSATUR " << heuristica.dsaturColors << " cores, tabucol " << heuristica.colors
+                     << " cores, clique " << heuristica.clique.size() << endl;
+            }
         }
-        
-        // Resultados
-        cout << "Solução ótima = " << cplex.getObjValue() << endl;
-        cout << numCores.getName() << cplex.getValue(numCores) << endl;
-        for (int i = 0; i < NUM_NOS; i++) {
-            cout << x[i].getName() << cplex.getValue(x[i]) << endl;
+        else {
+            throw runtime_error("método desconhecido para FrequencyProblem: " + opts.method);
         }
-        
     }
     catch (IloException& e) {
         cerr << "Erro CPLEX: " << e << endl;
     }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
     catch (...) {
         cerr << "Erro desconhecido" << endl;
     }
     env.end();
-    return 0;
-}
\ No newline at end of file
+    return result;
+}
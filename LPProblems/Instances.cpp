@@ -0,0 +1,766 @@
+#include "Instances.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <unordered_set>
+
+using namespace std;
+
+// Leitor
+
+Scanner::Scanner(string text, string source) : buf(move(text)), source(move(source)) {}
+
+Scanner Scanner::fromFile(const string &path) {
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) throw runtime_error("não foi possível abrir " + path);
+    string text;
+    char chunk[1 << 16];
+    size_t got;
+    while ((got = fread(chunk, 1, sizeof(chunk), f)) > 0) text.append(chunk, got);
+    fclose(f);
+    return Scanner(move(text), path);
+}
+
+void Scanner::skipSpaces() {
+    while (pos < buf.size() && (unsigned char)buf[pos] <= ' ') ++pos;
+}
+
+bool Scanner::eof() {
+    skipSpaces();
+    return pos >= buf.size();
+}
+
+string_view Scanner::token() {
+    skipSpaces();
+    if (pos >= buf.size()) fail("fim inesperado da instância");
+    size_t start = pos;
+    while (pos < buf.size() && (unsigned char)buf[pos] > ' ') ++pos;
+    return string_view(buf.data() + start, pos - start);
+}
+
+long long Scanner::integer() {
+    string_view t = token();
+    long long value = 0;
+    auto res = from_chars(t.data(), t.data() + t.size(), value);
+    if (res.ec != errc() || res.ptr != t.data() + t.size()) fail("inteiro inválido: " + string(t));
+    return value;
+}
+
+double Scanner::real() {
+    string_view t = token();
+    double value = 0;
+    auto res = from_chars(t.data(), t.data() + t.size(), value);
+    if (res.ec != errc() || res.ptr != t.data() + t.size()) fail("número inválido: " + string(t));
+    return value;
+}
+
+void Scanner::skipLine() {
+    while (pos < buf.size() && buf[pos] != '\n') ++pos;
+}
+
+void Scanner::fail(const string &message) const {
+    size_t line = 1 + count(buf.begin(), buf.begin() + min(pos, buf.size()), '\n');
+    throw runtime_error(source + ":" + to_string(line) + ": " + message);
+}
+
+namespace {
+
+int readCount(Scanner &in, const char *what) {
+    long long n = in.integer();
+    if (n <= 0 || n > 100000000) in.fail(string("quantidade inválida de ") + what);
+    return (int)n;
+}
+
+vector<double> readReals(Scanner &in, size_t n) {
+    vector<double> v(n);
+    for (auto &x : v) x = in.real();
+    return v;
+}
+
+template <typename T>
+vector<T> readInts(Scanner &in, size_t n) {
+    vector<T> v(n);
+    for (auto &x : v) x = (T)in.integer();
+    return v;
+}
+
+template <typename Data>
+Data load(const ProblemOptions &opts, Data (*parse)(Scanner &), Data (*generate)(int, mt19937 &),
+          const char *example) {
+    if (opts.size > 0) {
+        mt19937 rng(opts.seed);
+        return generate(opts.size, rng);
+    }
+    Scanner in = opts.instance.empty() ? Scanner(example) : Scanner::fromFile(opts.instance);
+    Data data = parse(in);
+    if (!in.eof()) in.fail("dados excedentes no fim da instância");
+    return data;
+}
+
+int uniform(mt19937 &rng, int lo, int hi) {
+    return uniform_int_distribution<int>(lo, hi)(rng);
+}
+
+double uniformReal(mt19937 &rng, double lo, double hi) {
+    return uniform_real_distribution<double>(lo, hi)(rng);
+}
+
+// Exemplos embutidos (os dados originais de cada problema)
+
+const char *RATION_EXAMPLE =
+    "2 2\n"
+    "11 12\n"            // Lucro líquido: AMGS = 20 - (5*1 + 1*4), RE = 30 - (2*1 + 4*4)
+    "5 2\n"              // Cereais (kg por unidade)
+    "1 4\n"              // Carne (kg por unidade)
+    "30000 10000\n";
+
+const char *DIET_EXAMPLE =
+    "2 6\n"
+    "1 0 2 2 1 2\n"      // Vitamina A
+    "0 1 3 1 3 2\n"      // Vitamina C
+    "9 19\n"
+    "35 30 60 50 27 22\n";
+
+const char *PLANTING_EXAMPLE =
+    "3 3\n"
+    "400 650 350\n"
+    "1800 2200 950\n"
+    "660 880 400\n"
+    "5000 4000 1800\n"
+    "5.5 4 3.5\n";
+
+const char *PAINT_EXAMPLE =
+    "4 2 2\n"            // Componentes SolA, SolB, SEC, COR; tintas SR, SN
+    "1.5 1 4 6\n"
+    "1000 250\n"
+    "0.3 0.6 1 0\n"      // Teor de SEC
+    "0.7 0.4 0 1\n"      // Teor de COR
+    "0.25 0.2\n"         // Mínimo de SEC em SR e SN
+    "0.5 0.5\n";         // Mínimo de COR em SR e SN
+
+const char *TRANSPORT_EXAMPLE =
+    "3 3\n"
+    "8 5 6\n"
+    "15 10 12\n"
+    "3 9 10\n"
+    "120 80 80\n"
+    "150 70 60\n";
+
+const char *MAXFLOW_EXAMPLE =
+    "p max 4 5\n"
+    "n 1 s\n"
+    "n 4 t\n"
+    "a 1 2 10\n"
+    "a 1 3 5\n"
+    "a 2 3 15\n"
+    "a 2 4 8\n"
+    "a 3 4 10\n";
+
+const char *SCHEDULE_EXAMPLE =
+    "7 5\n"
+    "2 3 4 2 3 1 1\n";   // Domingo a sábado
+
+const char *KNAPSACK_EXAMPLE =
+    "5 20\n"
+    "10 11\n"
+    "14 13\n"
+    "7 7\n"
+    "9 5\n"
+    "19 13\n";
+
+const char *PATTERN_EXAMPLE =
+    "4 2\n"
+    "200 90\n"
+    "50 50 3\n"
+    "1 1 7 2\n"
+    "2 2 3 3\n"
+    "1 0 9 2\n"
+    "1 4 4 1\n";
+
+const char *CUTTING_STOCK_EXAMPLE =
+    "4 100\n"
+    "45 97\n"
+    "36 610\n"
+    "31 395\n"
+    "14 211\n";
+
+const char *BIN_PACKING_EXAMPLE =
+    "10 8\n"
+    "6 5 4 4 3 3 2 2\n";
+
+const char *FACILITY_EXAMPLE =
+    "3 4\n"
+    "100 150 120\n"
+    "20 104 11 325\n"
+    "28 104 325 8\n"
+    "325 5 5 96\n";
+
+const char *COVER_EXAMPLE =
+    "p edge 5 6\n"
+    "e 1 2\ne 1 3\ne 2 3\ne 2 4\ne 3 4\ne 4 5\n";
+
+const char *FREQUENCY_EXAMPLE =
+    "p edge 5 10\n"
+    "e 1 2\ne 1 3\ne 1 4\ne 1 5\ne 2 3\ne 2 4\ne 2 5\ne 3 4\ne 3 5\ne 4 5\n";
+
+const char *CLIQUE_EXAMPLE =
+    "p edge 12 26\n"
+    "e 1 2\ne 1 3\ne 1 4\ne 1 5\ne 2 3\ne 2 6\ne 2 7\ne 3 4\ne 3 8\ne 4 5\ne 4 9\ne 4 10\n"
+    "e 5 10\ne 5 11\ne 6 7\ne 6 8\ne 6 12\ne 7 8\ne 7 12\ne 8 9\ne 8 12\ne 9 10\ne 9 12\n"
+    "e 10 11\ne 10 12\ne 11 12\n";
+
+// Leitura
+
+RationData parseRation(Scanner &in) {
+    RationData d;
+    d.numProdutos = readCount(in, "produtos");
+    d.numRecursos = readCount(in, "recursos");
+    d.lucro = readReals(in, d.numProdutos);
+    d.uso = readReals(in, (size_t)d.numRecursos * d.numProdutos);
+    d.disponivel = readReals(in, d.numRecursos);
+    return d;
+}
+
+DietData parseDiet(Scanner &in) {
+    DietData d;
+    d.numNutrientes = readCount(in, "nutrientes");
+    d.numIngredientes = readCount(in, "ingredientes");
+    d.conteudo = readReals(in, (size_t)d.numNutrientes * d.numIngredientes);
+    d.minimo = readReals(in, d.numNutrientes);
+    d.preco = readReals(in, d.numIngredientes);
+    return d;
+}
+
+PlantingData parsePlanting(Scanner &in) {
+    PlantingData d;
+    d.numFazendas = readCount(in, "fazendas");
+    d.numPlantios = readCount(in, "plantios");
+    d.area = readReals(in, d.numFazendas);
+    d.agua = readReals(in, d.numFazendas);
+    d.areaMaxPlantio = readReals(in, d.numPlantios);
+    d.lucro = readReals(in, d.numPlantios);
+    d.aguaPorArea = readReals(in, d.numPlantios);
+    return d;
+}
+
+PaintData parsePaint(Scanner &in) {
+    PaintData d;
+    d.numComponentes = readCount(in, "componentes");
+    d.numTintas = readCount(in, "tintas");
+    d.numAtributos = readCount(in, "atributos");
+    d.preco = readReals(in, d.numComponentes);
+    d.volume = readReals(in, d.numTintas);
+    d.teor = readReals(in, (size_t)d.numAtributos * d.numComponentes);
+    d.minimo = readReals(in, (size_t)d.numAtributos * d.numTintas);
+    return d;
+}
+
+TransportData parseTransport(Scanner &in) {
+    TransportData d;
+    d.numFabricas = readCount(in, "fábricas");
+    d.numDepositos = readCount(in, "depósitos");
+    d.custo = readInts<int>(in, (size_t)d.numFabricas * d.numDepositos);
+    d.oferta = readInts<int>(in, d.numFabricas);
+    d.demanda = readInts<int>(in, d.numDepositos);
+    for (int q : d.oferta) {
+        if (q < 0) in.fail("oferta negativa");
+    }
+    for (int q : d.demanda) {
+        if (q < 0) in.fail("demanda negativa");
+    }
+    return d;
+}
+
+ScheduleData parseSchedule(Scanner &in) {
+    ScheduleData d;
+    d.dias = readCount(in, "dias");
+    d.turno = readCount(in, "dias de turno");
+    if (d.turno > d.dias) in.fail("turno maior que o número de dias");
+    d.demanda = readInts<int>(in, d.dias);
+    return d;
+}
+
+KnapsackData parseKnapsack(Scanner &in) {
+    KnapsackData d;
+    d.numItens = readCount(in, "itens");
+    d.capacidade = in.integer();
+    if (d.capacidade < 0) in.fail("capacidade negativa");
+    d.valor.resize(d.numItens);
+    d.peso.resize(d.numItens);
+    for (int i = 0; i < d.numItens; i++) {
+        d.valor[i] = in.integer();
+        d.peso[i] = in.integer();
+        if (d.peso[i] < 0) in.fail("peso negativo");
+    }
+    return d;
+}
+
+PatternData parsePattern(Scanner &in) {
+    PatternData d;
+    d.numPadroes = readCount(in, "padrões");
+    d.numTiposFolha = readCount(in, "tipos de folha");
+    d.qtdFolhas = readInts<int>(in, d.numTiposFolha);
+    d.precoLatinha = in.integer();
+    d.custoCorpo = in.integer();
+    d.custoTampa = in.integer();
+    // O modelo linear das latinhas (min de corpos e tampas) depende disso
+    if (d.precoLatinha < 0 || d.custoCorpo < 0 || d.custoTampa < 0) in.fail("preço e custos não podem ser negativos");
+    for (int p = 0; p < d.numPadroes; p++) {
+        int folha = in.integer();
+        if (folha < 1 || folha > d.numTiposFolha) in.fail("tipo de folha inválido");
+        d.folha.push_back(folha);
+        d.corpos.push_back(in.integer());
+        d.tampas.push_back(in.integer());
+        d.tempo.push_back(in.integer());
+    }
+    return d;
+}
+
+CuttingStockData parseCuttingStock(Scanner &in) {
+    CuttingStockData d;
+    d.numItens = readCount(in, "itens");
+    d.larguraRolo = in.integer();
+    // A precificação é uma programação dinâmica sobre a largura do rolo
+    if (d.larguraRolo <= 0 || d.larguraRolo > 1000000) in.fail("largura do rolo inválida");
+    for (int i = 0; i < d.numItens; i++) {
+        long long largura = in.integer(), demanda = in.integer();
+        if (largura <= 0 || largura > d.larguraRolo) in.fail("largura de item inválida");
+        if (demanda < 0) in.fail("demanda negativa");
+        d.largura.push_back(largura);
+        d.demanda.push_back(demanda);
+    }
+    return d;
+}
+
+BinPackingData parseBinPacking(Scanner &in) {
+    BinPackingData d;
+    long long capacidade = in.integer();
+    // Os nós do fluxo em arcos são as cargas 0..capacidade
+    if (capacidade <= 0 || capacidade > 1000000) in.fail("capacidade inválida");
+    d.capacidade = (int)capacidade;
+    d.numItens = readCount(in, "itens");
+    for (int i = 0; i < d.numItens; i++) {
+        long long tamanho = in.integer();
+        if (tamanho <= 0 || tamanho > d.capacidade) in.fail("tamanho de item inválido");
+        d.tamanho.push_back((int)tamanho);
+    }
+    return d;
+}
+
+FacilityData parseFacility(Scanner &in) {
+    FacilityData d;
+    d.numCentros = readCount(in, "centros");
+    d.numClientes = readCount(in, "clientes");
+    d.custoInstalacao = readReals(in, d.numCentros);
+    d.custoAtendimento = readReals(in, (size_t)d.numCentros * d.numClientes);
+    return d;
+}
+
+// Geradores: "n" é o tamanho principal de cada problema
+
+RationData generateRation(int n, mt19937 &rng) {
+    RationData d;
+    d.numProdutos = n;
+    d.numRecursos = max(1, n / 2);
+    for (int p = 0; p < n; p++) d.lucro.push_back(uniform(rng, 5, 50));
+    d.uso.assign((size_t)d.numRecursos * n, 0.0);
+    for (int r = 0; r < d.numRecursos; r++) {
+        double total = 0;
+        for (int p = 0; p < n; p++) {
+            d.uso[(size_t)r * n + p] = uniform(rng, 0, 9);
+            total += d.uso[(size_t)r * n + p];
+        }
+        d.disponivel.push_back(round(total * uniform(rng, 10, 100)));
+    }
+    // Todo produto consome algum recurso (senão o modelo é ilimitado)
+    for (int p = 0; p < n; p++) d.uso[(size_t)uniform(rng, 0, d.numRecursos - 1) * n + p] += 1;
+    return d;
+}
+
+DietData generateDiet(int n, mt19937 &rng) {
+    DietData d;
+    d.numIngredientes = n;
+    d.numNutrientes = max(2, n / 4);
+    d.conteudo.assign((size_t)d.numNutrientes * n, 0.0);
+    for (int k = 0; k < d.numNutrientes; k++) {
+        for (int i = 0; i < n; i++) d.conteudo[(size_t)k * n + i] = uniform(rng, 0, 5);
+        d.conteudo[(size_t)k * n + uniform(rng, 0, n - 1)] += 1; // Nutriente sempre obtenível
+        d.minimo.push_back(uniform(rng, 10, 50));
+    }
+    for (int i = 0; i < n; i++) d.preco.push_back(uniform(rng, 10, 60));
+    return d;
+}
+
+PlantingData generatePlanting(int n, mt19937 &rng) {
+    PlantingData d;
+    d.numFazendas = n;
+    d.numPlantios = max(2, n / 2);
+    double areaTotal = 0;
+    for (int f = 0; f < n; f++) {
+        d.area.push_back(uniform(rng, 100, 1000));
+        d.agua.push_back(round(d.area.back() * uniformReal(rng, 2, 5)));
+        areaTotal += d.area.back();
+    }
+    for (int c = 0; c < d.numPlantios; c++) {
+        d.areaMaxPlantio.push_back(round(areaTotal / d.numPlantios * uniformReal(rng, 0.5, 1.5)));
+        d.lucro.push_back(uniform(rng, 1000, 5000));
+        d.aguaPorArea.push_back(uniform(rng, 4, 12) / 2.0);
+    }
+    return d;
+}
+
+PaintData generatePaint(int n, mt19937 &rng) {
+    PaintData d;
+    d.numAtributos = 2;
+    d.numComponentes = max(n, d.numAtributos);
+    d.numTintas = max(1, n / 4);
+    for (int k = 0; k < d.numComponentes; k++) d.preco.push_back(uniform(rng, 5, 60) / 10.0);
+    for (int t = 0; t < d.numTintas; t++) d.volume.push_back(uniform(rng, 100, 1000));
+    // Os primeiros componentes são puros (um por atributo), o que garante viabilidade
+    d.teor.assign((size_t)d.numAtributos * d.numComponentes, 0.0);
+    for (int k = 0; k < d.numComponentes; k++) {
+        if (k < d.numAtributos) {
+            d.teor[(size_t)k * d.numComponentes + k] = 1.0;
+            continue;
+        }
+        double resto = 1.0;
+        for (int a = 0; a < d.numAtributos; a++) {
+            double f = round(uniformReal(rng, 0, resto) * 100) / 100;
+            d.teor[(size_t)a * d.numComponentes + k] = f;
+            resto -= f;
+        }
+    }
+    for (int a = 0; a < d.numAtributos; a++) {
+        for (int t = 0; t < d.numTintas; t++) d.minimo.push_back(uniform(rng, 10, 45) / 100.0);
+    }
+    return d;
+}
+
+TransportData generateTransport(int n, mt19937 &rng) {
+    TransportData d;
+    d.numFabricas = d.numDepositos = n;
+    d.custo.resize((size_t)n * n);
+    for (auto &c : d.custo) c = uniform(rng, 1, 100);
+    long long oferta = 0, demanda = 0;
+    for (int i = 0; i < n; i++) {
+        d.oferta.push_back(uniform(rng, 50, 150));
+        oferta += d.oferta.back();
+    }
+    for (int j = 0; j < n; j++) {
+        d.demanda.push_back(uniform(rng, 50, 150));
+        demanda += d.demanda.back();
+    }
+    // Demanda total <= 90% da oferta total
+    if (demanda * 10 > oferta * 9) {
+        for (auto &q : d.demanda) q = (int)(q * (oferta * 0.9) / demanda);
+    }
+    return d;
+}
+
+// Rede em camadas (no estilo do gerador GENRMF): ~sqrt(n) camadas de ~sqrt(n) vértices, cada
+// vértice com 5 arcos para a camada seguinte e 2 dentro da própria camada; a origem
+// alimenta a primeira camada e a última camada escoa para o destino.
+FlowNetwork generateMaxFlow(int n, mt19937 &rng) {
+    FlowNetwork g;
+    const int largura = max(1, (int)sqrt(max(1, n - 2)));
+    const int camadas = max(1, (n - 2) / largura);
+    g.n = camadas * largura + 2;
+    g.origem = 0;
+    g.destino = g.n - 1;
+    g.arcs.reserve((size_t)g.n * 7 + 2 * largura);
+    auto vertice = [&](int camada, int i) { return 1 + camada * largura + i; };
+    for (int i = 0; i < largura; i++) {
+        g.arcs.push_back({g.origem, vertice(0, i), 100 * largura});
+        g.arcs.push_back({vertice(camadas - 1, i), g.destino, 100 * largura});
+    }
+    for (int c = 0; c < camadas; c++) {
+        for (int i = 0; i < largura; i++) {
+            int v = vertice(c, i);
+            if (c + 1 < camadas) {
+                for (int k = 0; k < 5; k++) {
+                    g.arcs.push_back({v, vertice(c + 1, uniform(rng, 0, largura - 1)), uniform(rng, 1, 100)});
+                }
+            }
+            for (int k = 0; k < 2 && largura > 1; k++) {
+                int w = vertice(c, uniform(rng, 0, largura - 1));
+                if (w != v) g.arcs.push_back({v, w, uniform(rng, 1, 100)});
+            }
+        }
+    }
+    return g;
+}
+
+ScheduleData generateSchedule(int n, mt19937 &rng) {
+    ScheduleData d;
+    d.dias = max(1, n);
+    d.turno = max(1, (5 * d.dias) / 7);
+    for (int i = 0; i < d.dias; i++) d.demanda.push_back(uniform(rng, 1, 10));
+    return d;
+}
+
+KnapsackData generateKnapsack(int n, mt19937 &rng) {
+    // Valores fracamente correlacionados com os pesos
+    KnapsackData d;
+    d.numItens = n;
+    long long total = 0;
+    for (int i = 0; i < n; i++) {
+        d.peso.push_back(uniform(rng, 1, 1000));
+        d.valor.push_back(max(1LL, d.peso.back() + uniform(rng, -100, 100)));
+        total += d.peso.back();
+    }
+    d.capacidade = total / 2;
+    return d;
+}
+
+PatternData generatePattern(int n, mt19937 &rng) {
+    PatternData d;
+    d.numPadroes = n;
+    d.numTiposFolha = max(2, n / 10);
+    for (int s = 0; s < d.numTiposFolha; s++) d.qtdFolhas.push_back(uniform(rng, 50, 300));
+    d.precoLatinha = 50;
+    d.custoCorpo = 50;
+    d.custoTampa = 3;
+    for (int p = 0; p < n; p++) {
+        d.folha.push_back(uniform(rng, 1, d.numTiposFolha));
+        d.corpos.push_back(uniform(rng, 0, 5));
+        d.tampas.push_back(uniform(rng, 0, 10));
+        d.tempo.push_back(uniform(rng, 1, 4));
+    }
+    return d;
+}
+
+CuttingStockData generateCuttingStock(int n, mt19937 &rng) {
+    // Carteira de pedidos: n larguras entre 1/20 e 1/2 do rolo
+    CuttingStockData d;
+    d.numItens = n;
+    d.larguraRolo = 10000;
+    for (int i = 0; i < n; i++) {
+        d.largura.push_back(uniform(rng, 500, 5000));
+        d.demanda.push_back(uniform(rng, 1, 100));
+    }
+    return d;
+}
+
+BinPackingData generateBinPacking(int n, mt19937 &rng) {
+    // Classe "u" do bin_packing.dat: itens de 20 a 100 em bins de 150
+    BinPackingData d;
+    d.capacidade = 150;
+    d.numItens = n;
+    for (int i = 0; i < n; i++) d.tamanho.push_back(uniform(rng, 20, 100));
+    return d;
+}
+
+FacilityData generateFacility(int n, mt19937 &rng) {
+    // Centros e clientes no quadrado unitário; custo de atendimento proporcional à distância
+    FacilityData d;
+    d.numCentros = n;
+    d.numClientes = 4 * n;
+    vector<pair<double, double>> centros(d.numCentros), clientes(d.numClientes);
+    for (auto &p : centros) p = {uniformReal(rng, 0, 1), uniformReal(rng, 0, 1)};
+    for (auto &p : clientes) p = {uniformReal(rng, 0, 1), uniformReal(rng, 0, 1)};
+    for (int i = 0; i < d.numCentros; i++) d.custoInstalacao.push_back(uniform(rng, 100, 200));
+    d.custoAtendimento.reserve((size_t)d.numCentros * d.numClientes);
+    for (const auto &c : centros) {
+        for (const auto &k : clientes) {
+            d.custoAtendimento.push_back(round(100 * hypot(c.first - k.first, c.second - k.second)));
+        }
+    }
+    return d;
+}
+
+// G(n, m) com m = grau médio * n / 2 arestas distintas
+Graph generateSparseGraph(int n, mt19937 &rng) {
+    Graph g;
+    g.n = max(2, n);
+    long long maxEdges = (long long)g.n * (g.n - 1) / 2;
+    long long m = min(maxEdges, 4LL * g.n);
+    unordered_set<long long> seen;
+    seen.reserve(m * 2);
+    while ((long long)g.edges.size() < m) {
+        int u = uniform(rng, 0, g.n - 1), v = uniform(rng, 0, g.n - 1);
+        if (u == v) continue;
+        if (u > v) swap(u, v);
+        if (seen.insert((long long)u * g.n + v).second) g.edges.push_back({u, v});
+    }
+    return g;
+}
+
+// Chung–Lu com graus em lei de potência (expoente 2,5) e grau médio ~4: poucos hubs e
+// muitos vértices de grau baixo, como nas redes esparsas reais
+Graph generatePowerLawGraph(int n, mt19937 &rng) {
+    Graph g;
+    g.n = max(2, n);
+    vector<double> peso(g.n);
+    for (int v = 0; v < g.n; v++) peso[v] = pow(v + 1.0, -1.0 / 1.5);
+    discrete_distribution<int> ponta(peso.begin(), peso.end());
+    long long maxEdges = (long long)g.n * (g.n - 1) / 2;
+    long long m = min(maxEdges / 2, 2LL * g.n);
+    unordered_set<long long> seen;
+    seen.reserve(m * 2);
+    while ((long long)g.edges.size() < m) {
+        int u = ponta(rng), v = ponta(rng);
+        if (u == v) continue;
+        if (u > v) swap(u, v);
+        if (seen.insert((long long)u * g.n + v).second) g.edges.push_back({u, v});
+    }
+    // Embaralha os rótulos para os hubs não serem sempre os primeiros vértices
+    vector<int> rotulo(g.n);
+    for (int v = 0; v < g.n; v++) rotulo[v] = v;
+    shuffle(rotulo.begin(), rotulo.end(), rng);
+    for (Edge &e : g.edges) e = {rotulo[e.from], rotulo[e.to]};
+    return g;
+}
+
+Graph generateDenseGraph(int n, mt19937 &rng) {
+    Graph g;
+    g.n = max(2, n);
+    bernoulli_distribution coin(0.5);
+    for (int u = 0; u < g.n; u++) {
+        for (int v = u + 1; v < g.n; v++) {
+            if (coin(rng)) g.edges.push_back({u, v});
+        }
+    }
+    return g;
+}
+
+}  // namespace
+
+Graph parseDimacsGraph(Scanner &in) {
+    Graph g;
+    bool header = false;
+    while (!in.eof()) {
+        string_view kind = in.token();
+        if (kind == "c") {
+            in.skipLine();
+        }
+        else if (kind == "p") {
+            in.token(); // "edge" ou "col"
+            g.n = readCount(in, "vértices");
+            long long m = in.integer();
+            if (m < 0) in.fail("número de arestas inválido");
+            g.edges.reserve(m);
+            header = true;
+        }
+        else if (kind == "e" && header) {
+            long long u = in.integer(), v = in.integer();
+            if (u < 1 || u > g.n || v < 1 || v > g.n) in.fail("vértice fora do intervalo");
+            if (u != v) g.edges.push_back({(int)u - 1, (int)v - 1});
+        }
+        else {
+            in.fail("linha DIMACS inesperada: " + string(kind));
+        }
+    }
+    if (!header) in.fail("linha \"p\" ausente");
+    return g;
+}
+
+FlowNetwork parseDimacsFlow(Scanner &in) {
+    FlowNetwork g;
+    bool header = false, hasSource = false, hasSink = false;
+    while (!in.eof()) {
+        string_view kind = in.token();
+        if (kind == "c") {
+            in.skipLine();
+        }
+        else if (kind == "p") {
+            if (in.token() != "max") in.fail("esperado \"p max\"");
+            g.n = readCount(in, "vértices");
+            long long m = in.integer();
+            if (m < 0) in.fail("número de arcos inválido");
+            g.arcs.reserve(m);
+            header = true;
+        }
+        else if (kind == "n" && header) {
+            long long v = in.integer();
+            if (v < 1 || v > g.n) in.fail("vértice fora do intervalo");
+            string_view role = in.token();
+            if (role == "s") {
+                g.origem = v - 1;
+                hasSource = true;
+            }
+            else if (role == "t") {
+                g.destino = v - 1;
+                hasSink = true;
+            }
+            else {
+                in.fail("esperado \"s\" ou \"t\"");
+            }
+        }
+        else if (kind == "a" && header) {
+            long long u = in.integer(), v = in.integer(), cap = in.integer();
+            if (u < 1 || u > g.n || v < 1 || v > g.n) in.fail("vértice fora do intervalo");
+            if (cap < 0 || cap > 2147483647LL) in.fail("capacidade inválida");
+            g.arcs.push_back({(int)u - 1, (int)v - 1, (int)cap});
+        }
+        else {
+            in.fail("linha DIMACS inesperada: " + string(kind));
+        }
+    }
+    if (!header || !hasSource || !hasSink) in.fail("linhas \"p\", \"n s\" ou \"n t\" ausentes");
+    if (g.origem == g.destino) in.fail("origem e destino iguais");
+    return g;
+}
+
+RationData loadRation(const ProblemOptions &opts) {
+    return load(opts, parseRation, generateRation, RATION_EXAMPLE);
+}
+
+DietData loadDiet(const ProblemOptions &opts) {
+    return load(opts, parseDiet, generateDiet, DIET_EXAMPLE);
+}
+
+PlantingData loadPlanting(const ProblemOptions &opts) {
+    return load(opts, parsePlanting, generatePlanting, PLANTING_EXAMPLE);
+}
+
+PaintData loadPaint(const ProblemOptions &opts) {
+    return load(opts, parsePaint, generatePaint, PAINT_EXAMPLE);
+}
+
+TransportData loadTransport(const ProblemOptions &opts) {
+    return load(opts, parseTransport, generateTransport, TRANSPORT_EXAMPLE);
+}
+
+FlowNetwork loadMaxFlow(const ProblemOptions &opts) {
+    return load(opts, parseDimacsFlow, generateMaxFlow, MAXFLOW_EXAMPLE);
+}
+
+ScheduleData loadSchedule(const ProblemOptions &opts) {
+    return load(opts, parseSchedule, generateSchedule, SCHEDULE_EXAMPLE);
+}
+
+KnapsackData loadKnapsack(const ProblemOptions &opts) {
+    return load(opts, parseKnapsack, generateKnapsack, KNAPSACK_EXAMPLE);
+}
+
+PatternData loadPattern(const ProblemOptions &opts) {
+    return load(opts, parsePattern, generatePattern, PATTERN_EXAMPLE);
+}
+
+CuttingStockData loadCuttingStock(const ProblemOptions &opts) {
+    return load(opts, parseCuttingStock, generateCuttingStock, CUTTING_STOCK_EXAMPLE);
+}
+
+BinPackingData loadBinPacking(const ProblemOptions &opts) {
+    return load(opts, parseBinPacking, generateBinPacking, BIN_PACKING_EXAMPLE);
+}
+
+FacilityData loadFacility(const ProblemOptions &opts) {
+    return load(opts, parseFacility, generateFacility, FACILITY_EXAMPLE);
+}
+
+Graph loadCoverGraph(const ProblemOptions &opts) {
+    return load(opts, parseDimacsGraph, generatePowerLawGraph, COVER_EXAMPLE);
+}
+
+Graph loadFrequencyGraph(const ProblemOptions &opts) {
+    return load(opts, parseDimacsGraph, generateSparseGraph, FREQUENCY_EXAMPLE);
+}
+
+Graph loadCliqueGraph(const ProblemOptions &opts) {
+    return load(opts, parseDimacsGraph, generateDenseGraph, CLIQUE_EXAMPLE);
+}
@@ -0,0 +1,225 @@
+// LPProblems/Instances.hpp
+// Dados de entrada dos problemas: formato dos arquivos de instância, leitor rápido e
+// geradores aleatórios.
+//
+// Cada problema obtém seus dados por "loadX(opts)":
+// - opts.size > 0: instância aleatória gerada com "opts.size" e "opts.seed";
+// - opts.instance não vazio: arquivo de instância no formato documentado abaixo;
+// - caso contrário: o exemplo embutido (o mesmo exemplo pequeno de antes, escrito no
+//   formato de arquivo e lido pelo mesmo leitor).
+//
+// Os arquivos são sequências de números separados por espaços/quebras de linha, exceto
+// os grafos, que usam o formato DIMACS. Erros de formato lançam std::runtime_error com a
+// linha do arquivo.
+#ifndef INSTANCES_HPP
+#define INSTANCES_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct ProblemOptions {
+    std::string instance;  // Arquivo de instância; vazio = exemplo embutido
+    int size = 0;          // > 0: gera uma instância aleatória desse tamanho
+    unsigned seed = 1;     // Semente do gerador
+
+    // Resolução
+    std::string method = "cplex";  // "cplex" ou um algoritmo nativo do problema (ex.: "dinic")
+    int threads = 0;        // Threads do CPLEX; 0 = escolha do CPLEX
+    double timeLimit = 0;   // Limite de tempo do CPLEX em segundos; 0 = sem limite
+    double gap = -1;        // Gap relativo de parada (MIP); < 0 = padrão do CPLEX
+    bool quiet = false;     // Não imprime a solução
+    bool cplexLog = true;   // Mostra o log do CPLEX
+    bool lean = false;      // Modelos sem nomes de variáveis (ModelBuilder)
+};
+
+// Leitor de tokens sobre o arquivo inteiro em memória (uma leitura, sem iostreams)
+class Scanner {
+public:
+    explicit Scanner(std::string text, std::string source = "exemplo");
+    static Scanner fromFile(const std::string &path);
+
+    bool eof();                 // Fim do texto (após pular espaços)
+    std::string_view token();   // Próximo token separado por espaços
+    long long integer();
+    double real();
+    void skipLine();            // Descarta o restante da linha atual
+    [[noreturn]] void fail(const std::string &message) const;
+
+private:
+    void skipSpaces();
+
+    std::string buf;
+    std::string source;
+    size_t pos = 0;
+};
+
+// Número máximo de valores da solução impressos por problema (instâncias grandes)
+const int MAX_DETALHES = 50;
+
+struct Edge {
+    int from;
+    int to;
+};
+
+struct Arc {
+    int from;
+    int to;
+    int capacity;
+};
+
+// Grafo não direcionado (vértices 0..n-1).
+// Formato DIMACS: linhas "c ..." (comentário), "p edge <n> <m>" e m linhas "e <u> <v>"
+// com vértices numerados a partir de 1.
+struct Graph {
+    int n = 0;
+    std::vector<Edge> edges;
+};
+
+// RationProblem: produção de P produtos com R recursos limitados, maximizando o lucro.
+// Formato: "P R", lucro[P], uso[R][P] (recurso r por unidade do produto p), disponivel[R].
+struct RationData {
+    int numProdutos = 0;
+    int numRecursos = 0;
+    std::vector<double> lucro;
+    std::vector<double> uso;  // numRecursos x numProdutos
+    std::vector<double> disponivel;
+};
+
+// DietProblem: I ingredientes e N nutrientes, minimizando o custo.
+// Formato: "N I", conteudo[N][I], minimo[N], preco[I].
+struct DietData {
+    int numNutrientes = 0;
+    int numIngredientes = 0;
+    std::vector<double> conteudo;  // numNutrientes x numIngredientes
+    std::vector<double> minimo;
+    std::vector<double> preco;
+};
+
+// PlantingProblem: F fazendas e C plantios, com a mesma proporção de área plantada em
+// todas as fazendas.
+// Formato: "F C", area[F], agua[F], areaMaxPlantio[C], lucro[C], aguaPorArea[C].
+struct PlantingData {
+    int numFazendas = 0;
+    int numPlantios = 0;
+    std::vector<double> area;
+    std::vector<double> agua;
+    std::vector<double> areaMaxPlantio;
+    std::vector<double> lucro;
+    std::vector<double> aguaPorArea;
+};
+
+// PaintProblem: mistura de K componentes em T tintas, com A atributos de qualidade.
+// Formato: "K T A", preco[K], volume[T], teor[A][K] (fração do atributo no componente),
+// minimo[A][T] (fração mínima do atributo na tinta).
+struct PaintData {
+    int numComponentes = 0;
+    int numTintas = 0;
+    int numAtributos = 0;
+    std::vector<double> preco;
+    std::vector<double> volume;
+    std::vector<double> teor;    // numAtributos x numComponentes
+    std::vector<double> minimo;  // numAtributos x numTintas
+};
+
+// TransportProblem: F fábricas e D depósitos.
+// Formato: "F D", custo[F][D], oferta[F], demanda[D]. Custo negativo: rota não permitida.
+struct TransportData {
+    int numFabricas = 0;
+    int numDepositos = 0;
+    std::vector<int> custo;  // numFabricas x numDepositos, por linhas
+    std::vector<int> oferta;
+    std::vector<int> demanda;
+
+    bool permitida(int i, int j) const { return custo[(size_t)i * numDepositos + j] >= 0; }
+};
+
+// MaxFlowProblem: rede com capacidades inteiras (vértices 0..n-1).
+// Formato DIMACS max-flow: "p max <n> <m>", "n <v> s", "n <v> t" e m linhas
+// "a <u> <v> <capacidade>", com vértices numerados a partir de 1.
+struct FlowNetwork {
+    int n = 0;
+    int origem = 0;
+    int destino = 0;
+    std::vector<Arc> arcs;
+};
+
+// ScheduleScalingProblem: W dias, turnos de K dias consecutivos (circular).
+// Formato: "W K", demanda[W].
+struct ScheduleData {
+    int dias = 0;
+    int turno = 0;
+    std::vector<int> demanda;
+};
+
+// KnapsackProblem: n itens.
+// Formato: "n capacidade" e n linhas "valor peso".
+struct KnapsackData {
+    int numItens = 0;
+    long long capacidade = 0;
+    std::vector<long long> valor;
+    std::vector<long long> peso;
+};
+
+// PatternProblem: P padrões de corte em S tipos de folha.
+// Formato: "P S", qtdFolhas[S], "precoLatinha custoCorpo custoTampa" e P linhas
+// "folha corpos tampas tempo" (folha numerada a partir de 1).
+struct PatternData {
+    int numPadroes = 0;
+    int numTiposFolha = 0;
+    std::vector<int> qtdFolhas;
+    int precoLatinha = 0;
+    int custoCorpo = 0;
+    int custoTampa = 0;
+    std::vector<int> folha;
+    std::vector<int> corpos;
+    std::vector<int> tampas;
+    std::vector<int> tempo;
+};
+
+// CuttingStockProblem: n tipos de item cortados de rolos de mesma largura.
+// Formato: "n larguraRolo" e n linhas "largura demanda" (0 < largura <= larguraRolo).
+struct CuttingStockData {
+    int numItens = 0;
+    long long larguraRolo = 0;
+    std::vector<long long> largura;
+    std::vector<long long> demanda;
+};
+
+// BinPackingProblem: n itens em bins de mesma capacidade (o formato de uma instância do
+// BinPacking). Formato: "capacidade n" e os n tamanhos (0 < tamanho <= capacidade).
+struct BinPackingData {
+    int capacidade = 0;
+    int numItens = 0;
+    std::vector<int> tamanho;
+};
+
+// FacilityProblem: m centros candidatos e n clientes.
+// Formato: "m n", custoInstalacao[m], custoAtendimento[m][n].
+struct FacilityData {
+    int numCentros = 0;
+    int numClientes = 0;
+    std::vector<double> custoInstalacao;
+    std::vector<double> custoAtendimento;  // numCentros x numClientes
+};
+
+RationData loadRation(const ProblemOptions &opts);
+DietData loadDiet(const ProblemOptions &opts);
+PlantingData loadPlanting(const ProblemOptions &opts);
+PaintData loadPaint(const ProblemOptions &opts);
+TransportData loadTransport(const ProblemOptions &opts);
+FlowNetwork loadMaxFlow(const ProblemOptions &opts);
+ScheduleData loadSchedule(const ProblemOptions &opts);
+KnapsackData loadKnapsack(const ProblemOptions &opts);
+PatternData loadPattern(const ProblemOptions &opts);
+CuttingStockData loadCuttingStock(const ProblemOptions &opts);
+BinPackingData loadBinPacking(const ProblemOptions &opts);
+FacilityData loadFacility(const ProblemOptions &opts);
+Graph loadCoverGraph(const ProblemOptions &opts);      // Gerador: lei de potência, grau médio ~4
+Graph loadFrequencyGraph(const ProblemOptions &opts);  // Gerador: grau médio ~8
+Graph loadCliqueGraph(const ProblemOptions &opts);     // Gerador: densidade 0,5
+
+Graph parseDimacsGraph(Scanner &in);
+FlowNetwork parseDimacsFlow(Scanner &in);
+
+#endif
@@ -0,0 +1,355 @@
+#include "Knapsack.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include "Scheduler.hpp"
+
+using namespace std;
+
+namespace {
+
+struct Item {
+    long long p, w;
+    int id;
+};
+
+// Itens que podem entrar: peso 0 com valor positivo entram sempre; valor <= 0 ou peso
+// acima da capacidade nunca entram
+vector<Item> usefulItems(const KnapsackData &d, KnapsackResult &r) {
+    vector<Item> itens;
+    for (int i = 0; i < d.numItens; i++) {
+        if (d.valor[i] <= 0 || d.peso[i] > d.capacidade) continue;
+        if (d.peso[i] == 0) {
+            r.items.push_back(i);
+            r.value += d.valor[i];
+        }
+        else {
+            itens.push_back({d.valor[i], d.peso[i], i});
+        }
+    }
+    return itens;
+}
+
+// Ordem de eficiência p/w decrescente (produto cruzado, sem divisão)
+void sortByEfficiency(vector<Item> &itens) {
+    sort(itens.begin(), itens.end(), [](const Item &a, const Item &b) {
+        __int128 esquerda = (__int128)a.p * b.w, direita = (__int128)b.p * a.w;
+        return esquerda != direita ? esquerda > direita : a.w < b.w;
+    });
+}
+
+// Limite de Dantzig sobre os itens já ordenados
+long long dantzigBound(const vector<Item> &itens, long long c) {
+    long long p = 0, w = 0;
+    for (const Item &it : itens) {
+        if (w + it.w > c) return p + (long long)((__int128)(c - w) * it.p / it.w);
+        p += it.p;
+        w += it.w;
+    }
+    return p;
+}
+
+// Capacidade útil: não passa da soma dos pesos
+long long usefulCapacity(const KnapsackData &d, int &numItens) {
+    long long soma = 0;
+    numItens = 0;
+    for (int i = 0; i < d.numItens; i++) {
+        if (d.valor[i] > 0 && d.peso[i] > 0 && d.peso[i] <= d.capacidade) {
+            soma += d.peso[i];
+            numItens++;
+        }
+    }
+    return min(soma, d.capacidade);
+}
+
+// Células da programação dinâmica: bits de decisão e as duas linhas de valores (128 bits
+// por capacidade)
+long long dpCells(const KnapsackData &d) {
+    int numItens;
+    long long c = usefulCapacity(d, numItens);
+    __int128 celulas = (__int128)(numItens + 128) * (c + 1);
+    return celulas > KNAPSACK_DP_LIMIT ? KNAPSACK_DP_LIMIT + 1 : (long long)celulas;
+}
+
+// Enumeração do núcleo (minknap, Pisinger): estados (peso, valor) obtidos da solução da
+// quebra trocando itens, expandida alternadamente com t = b, b+1, ... (entra) e
+// s = b-1, b-2, ... (sai). A cada passo a lista, ordenada por peso, é intercalada com a
+// cópia deslocada pelo item; saem os estados dominados (mais peso sem mais valor) e os
+// cujo limite, com a eficiência do próximo item a entrar ou sair, não supera a melhor
+// solução. Só os estados que mudam ganham um registro (item trocado, registro anterior)
+// para recuperar a solução no fim.
+class Minknap {
+public:
+    Minknap(const vector<Item> &itensOrdenados, long long capacidade, double timeLimit, size_t maxStates)
+        : it(itensOrdenados), c(capacidade), limite(timeLimit), maxEstados(maxStates) {}
+
+    // Procura a melhor solução de valor >= lowerBound e devolve as posições dos itens em
+    // "escolhidos"; false se nenhuma alcança lowerBound (o chamador já tem uma com ele)
+    bool solve(long long lowerBound, vector<int> &escolhidos, long long &valor, long long &states, bool &optimal) {
+        const auto inicio = chrono::steady_clock::now();
+        const int m = it.size();
+        int b = 0;
+        long long ps = 0, ws = 0;
+        while (b < m && ws + it[b].w <= c) {
+            ps += it[b].p;
+            ws += it[b++].w;
+        }
+        z = ps;
+        zRegistro = -1;
+        piso = max(z, lowerBound);
+        lista.assign(1, {ws, ps, -1});
+        optimal = true;
+        int s = b - 1, t = b;
+        while (!lista.empty() && (s >= 0 || t < m)) {
+            if (lista.size() > maxEstados || (limite > 0 && chrono::duration<double>(chrono::steady_clock::now() - inicio).count() > limite)) {
+                optimal = false;
+                break;
+            }
+            if (t < m) {
+                expand(t, +1, s, t + 1);
+                t++;
+            }
+            if (s >= 0 && !lista.empty()) {
+                expand(s, -1, s - 1, t);
+                s--;
+            }
+        }
+        states = estados;
+        if (z < lowerBound) return false;
+
+        // Solução da quebra com os itens do registro da melhor solução trocados
+        vector<char> dentro(m, 0);
+        for (int k = 0; k < b; k++) dentro[k] = 1;
+        for (int r = zRegistro; r >= 0; r = registros[r].anterior) dentro[registros[r].item] ^= 1;
+        escolhidos.clear();
+        for (int k = 0; k < m; k++) {
+            if (dentro[k]) escolhidos.push_back(k);
+        }
+        valor = z;
+        return true;
+    }
+
+private:
+    struct Estado {
+        long long w, p;
+        int registro;
+    };
+    struct Registro {
+        int anterior, item;
+    };
+
+    // Limite do estado (w, p) com os próximos itens s (sai) e t (entra): a folga preenchida
+    // com a eficiência de t, ou o excesso retirado com a de s
+    long long bound(long long w, long long p, int s, int t) const {
+        if (w <= c) {
+            return t < (int)it.size() ? p + (long long)((__int128)(c - w) * it[t].p / it[t].w) : p;
+        }
+        return s >= 0 ? p - (long long)(((__int128)(w - c) * it[s].p + it[s].w - 1) / it[s].w) : LLONG_MIN;
+    }
+
+    // Intercala a lista com a cópia trocada pelo item k (sinal +1 entra, -1 sai); s e t
+    // são os próximos itens depois deste passo
+    void expand(int k, int sinal, int s, int t) {
+        const long long dw = sinal * it[k].w, dp = sinal * it[k].p;
+        nova.clear();
+        size_t i = 0, j = 0;
+        while (i < lista.size() || j < lista.size()) {
+            Estado e;
+            bool trocado;
+            if (j >= lista.size() ||
+                (i < lista.size() && (lista[i].w < lista[j].w + dw ||
+                                      (lista[i].w == lista[j].w + dw && lista[i].p >= lista[j].p + dp)))) {
+                e = lista[i++];
+                trocado = false;
+            }
+            else {
+                e = {lista[j].w + dw, lista[j].p + dp, lista[j].registro};
+                j++;
+                trocado = true;
+            }
+            if (!nova.empty() && e.p <= nova.back().p) continue;  // dominado
+            estados++;
+            bool melhor = e.w <= c && e.p > z;
+            if (!melhor && bound(e.w, e.p, s, t) <= piso) continue;
+            if (trocado) {
+                registros.push_back({e.registro, k});
+                e.registro = registros.size() - 1;
+            }
+            if (melhor) {
+                z = e.p;
+                zRegistro = e.registro;
+                piso = max(piso, z);
+                if (bound(e.w, e.p, s, t) <= piso) continue;
+            }
+            nova.push_back(e);
+        }
+        swap(lista, nova);
+    }
+
+    const vector<Item> &it;
+    long long c, z = 0, piso = 0;
+    int zRegistro = -1;
+    double limite;
+    size_t maxEstados;
+    long long estados = 0;
+    vector<Estado> lista, nova;
+    vector<Registro> registros;
+};
+
+// Linhas da programação dinâmica com valores do tipo V: int32 quando a soma dos valores
+// cabe, o que reduz à metade a memória percorrida por item. Devolve o ótimo e preenche os
+// bits de decisão (item k, capacidade c).
+template <typename V>
+V dpTable(const vector<Item> &itens, long long C, vector<uint64_t> &escolha) {
+    const size_t palavras = (C + 1 + 63) / 64;
+    vector<V> anterior(C + 1, 0), atual(C + 1);
+    for (size_t k = 0; k < itens.size(); k++) {
+        const V p = itens[k].p;
+        const long long w = itens[k].w;
+        const V *a = anterior.data();
+        V *b = atual.data();
+        uint64_t *bits = &escolha[k * palavras];
+        copy(a, a + w, b);
+        // Blocos de 64 capacidades: uma palavra de decisões por bloco
+        for (long long inicio = w & ~63LL; inicio <= C; inicio += 64) {
+            const long long de = max(inicio, w), ate = min(inicio + 63, C);
+            uint64_t mascara = 0;
+            for (long long c = de; c <= ate; c++) {
+                V com = a[c - w] + p;
+                bool entra = com > a[c];
+                b[c] = entra ? com : a[c];
+                mascara |= (uint64_t)entra << (c - inicio);
+            }
+            bits[inicio >> 6] = mascara;
+        }
+        swap(anterior, atual);
+    }
+    return anterior[C];
+}
+
+KnapsackResult minknap(const KnapsackData &d, double timeLimit, size_t maxStates) {
+    KnapsackResult r;
+    r.method = "minknap";
+    vector<Item> itens = usefulItems(d, r);
+    sortByEfficiency(itens);
+    const long long c = d.capacidade;
+    const int m = itens.size();
+    r.upperBound = r.value + dantzigBound(itens, c);
+
+    // Solução gulosa: os itens em ordem de eficiência que ainda cabem
+    vector<char> guloso(m, 0);
+    long long zGuloso = 0, wGuloso = 0;
+    for (int k = 0; k < m; k++) {
+        if (wGuloso + itens[k].w <= c) {
+            guloso[k] = 1;
+            zGuloso += itens[k].p;
+            wGuloso += itens[k].w;
+        }
+    }
+
+    Minknap solver(itens, c, timeLimit, maxStates);
+    vector<int> posicoes;
+    long long valor;
+    if (solver.solve(zGuloso, posicoes, valor, r.states, r.optimal) && valor > zGuloso) {
+        for (int k : posicoes) r.items.push_back(itens[k].id);
+        r.value += valor;
+    }
+    else {
+        for (int k = 0; k < m; k++) {
+            if (guloso[k]) r.items.push_back(itens[k].id);
+        }
+        r.value += zGuloso;
+    }
+    sort(r.items.begin(), r.items.end());
+    if (r.value == r.upperBound) r.optimal = true;
+    return r;
+}
+
+}  // namespace
+
+bool fitsKnapsackDP(const KnapsackData &d) {
+    return dpCells(d) <= KNAPSACK_DP_LIMIT;
+}
+
+KnapsackResult knapsackDP(const KnapsackData &d) {
+    if (!fitsKnapsackDP(d)) {
+        throw runtime_error("mochila grande demais para a programação dinâmica (use -method minknap)");
+    }
+    KnapsackResult r;
+    r.method = "dp";
+    vector<Item> itens = usefulItems(d, r);
+    int numItens;
+    const long long C = usefulCapacity(d, numItens);
+    const size_t palavras = (C + 1 + 63) / 64;
+
+    vector<uint64_t> escolha(itens.size() * palavras, 0);
+    long long soma = 0;
+    for (const Item &it : itens) soma += it.p;
+    const long long otimo = soma <= INT32_MAX ? dpTable<int32_t>(itens, C, escolha) : dpTable<long long>(itens, C, escolha);
+    r.value += otimo;
+
+    // Recupera os itens de trás para frente
+    long long c = C;
+    for (size_t k = itens.size(); k-- > 0;) {
+        if (escolha[k * palavras + (c >> 6)] >> (c & 63) & 1) {
+            r.items.push_back(itens[k].id);
+            c -= itens[k].w;
+        }
+    }
+    sort(r.items.begin(), r.items.end());
+    long long gratis = r.value - otimo;
+    sortByEfficiency(itens);
+    r.upperBound = gratis + dantzigBound(itens, d.capacidade);
+    return r;
+}
+
+KnapsackResult knapsackMinknap(const KnapsackData &d, double timeLimit) {
+    return minknap(d, timeLimit, SIZE_MAX);
+}
+
+KnapsackResult solveKnapsack(const KnapsackData &d, double timeLimit) {
+    // O minknap costuma ficar com poucos estados, mas a lista cresce até a capacidade em
+    // instâncias fortemente correlacionadas (p = w + k). Se a programação dinâmica couber,
+    // ele tem um teto de estados da ordem do custo dela e cede a vez quando o estoura.
+    const long long celulas = dpCells(d);
+    if (celulas > KNAPSACK_DP_LIMIT) return minknap(d, timeLimit, SIZE_MAX);
+    KnapsackResult r = minknap(d, timeLimit, max(100000LL, celulas / 64));
+    return r.optimal ? r : knapsackDP(d);
+}
+
+vector<KnapsackResult> solveKnapsacks(const vector<KnapsackData> &lote, int workers, double timeLimit) {
+    if (workers <= 0) workers = max(1u, thread::hardware_concurrency());
+    vector<KnapsackResult> resultados(lote.size());
+    runConcurrent(lote.size(), workers, [&](size_t i) { resultados[i] = solveKnapsack(lote[i], timeLimit); });
+    return resultados;
+}
+
+bool checkKnapsack(const KnapsackData &d, const KnapsackResult &r, string &erro) {
+    long long peso = 0, valor = 0;
+    for (size_t k = 0; k < r.items.size(); k++) {
+        int i = r.items[k];
+        if (i < 0 || i >= d.numItens || (k > 0 && i <= r.items[k - 1])) {
+            erro = "item inválido ou repetido: " + to_string(i);
+            return false;
+        }
+        peso += d.peso[i];
+        valor += d.valor[i];
+    }
+    if (peso > d.capacidade) {
+        erro = "peso " + to_string(peso) + " acima da capacidade " + to_string(d.capacidade);
+        return false;
+    }
+    if (valor != r.value) {
+        erro = "valor dos itens " + to_string(valor) + " diferente do informado " + to_string(r.value);
+        return false;
+    }
+    if (r.value > r.upperBound) {
+        erro = "valor acima do limite de Dantzig";
+        return false;
+    }
+    return true;
+}
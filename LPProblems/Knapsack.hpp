@@ -0,0 +1,50 @@
+// LPProblems/Knapsack.hpp
+// Mochila 0-1 nativa (sem CPLEX) para o KnapsackProblem.
+//
+// - Programação dinâmica sobre a capacidade: duas linhas de valores (int32 quando a soma
+//   dos valores cabe), com max(anterior[c], anterior[c - w] + p) em blocos de 64
+//   capacidades, e as decisões de cada bloco numa palavra de 64 bits para recuperar os
+//   itens. Memória O(n * C / 8) bytes: só para capacidades moderadas.
+// - Minknap (Pisinger): itens em ordem de eficiência p/w, partindo da solução do item de
+//   quebra e expandindo o núcleo em volta dele com uma lista de estados (peso, valor) sem
+//   dominados, podada pelo limite de Dantzig do próximo item. Serve para qualquer
+//   capacidade.
+// - Lote: várias mochilas independentes resolvidas em paralelo (runConcurrent).
+#ifndef KNAPSACK_HPP
+#define KNAPSACK_HPP
+#include <string>
+#include <vector>
+#include "Instances.hpp"
+
+struct KnapsackResult {
+    long long value = 0;
+    std::vector<int> items;  // Itens escolhidos, em ordem crescente
+    long long upperBound = 0;  // Limite de Dantzig (relaxação linear)
+    bool optimal = true;     // false se o limite de tempo interrompeu o minknap
+    long long states = 0;    // Estados gerados pelo minknap (0 na programação dinâmica)
+    std::string method;      // "dp" ou "minknap"
+};
+
+// Células (itens x capacidades) acima das quais a programação dinâmica não é usada
+const long long KNAPSACK_DP_LIMIT = 1LL << 29;
+
+bool fitsKnapsackDP(const KnapsackData &d);
+
+// Programação dinâmica; lança runtime_error se a instância não couber no limite
+KnapsackResult knapsackDP(const KnapsackData &d);
+
+// Minknap (timeLimit em segundos, 0: sem limite)
+KnapsackResult knapsackMinknap(const KnapsackData &d, double timeLimit = 0);
+
+// Minknap; se a programação dinâmica couber, com um teto de estados da ordem do custo
+// dela, que assume quando o teto estoura
+KnapsackResult solveKnapsack(const KnapsackData &d, double timeLimit = 0);
+
+// Resolve o lote com "workers" threads (0: todos os núcleos)
+std::vector<KnapsackResult> solveKnapsacks(const std::vector<KnapsackData> &lote, int workers = 0,
+                                           double timeLimit = 0);
+
+// Confere peso, valor e índices da solução
+bool checkKnapsack(const KnapsackData &d, const KnapsackResult &r, std::string &erro);
+
+#endif
@@ -1,64 +1,154 @@
 #include <ilcplex/ilocplex.h>
 #include <vector>
+#include <iostream>
+#include <stdexcept>
+#include "Problems.hpp"
+#include "Knapsack.hpp"
+#include "ModelBuilder.hpp"
 ILOSTLBEGIN
 
-int KnapsackProblem() {
-    IloEnv env;
-    try {
-        // Criar modelo
-        IloModel model(env);
+static bool solveCplex(IloEnv env, const KnapsackData &d, const ProblemOptions &opts, ProblemResult &result,
+                       vector<int> &itens) {
+    Timer timer;
+    const int NUM_ITENS = d.numItens;
 
-        //Constantes
-        const int NUM_ITENS = 5;
-        const int CAPACIDADE_MOCHILA = 20;
-        const std::vector<int> VALORES = {10, 14, 7, 9, 19};
-        const std::vector<int> PESOS = {11, 13, 7, 5, 13};
+    // Criar modelo
+    IloModel model(env);
+    ModelBuilder mb(env, opts);
 
-        // Variáveis de decisão
-        IloIntVarArray x(env, NUM_ITENS, 0, 1);
-        for (int i = 0; i < NUM_ITENS; i++) {
-            x[i].setName(("X" + std::to_string(i)).c_str());
-        }
+    // Variáveis de decisão
+    const int x = mb.addVars(NUM_ITENS, 0, 1, IloNumVar::Int, [](int i) { return "X" + std::to_string(i); });
 
+    // Função objetivo: Máximizar os valores dos itens na mochila
+    for (int i = 0; i < NUM_ITENS; i++) {
+        mb.setObjective(x + i, (IloNum)d.valor[i]);
+    }
 
-        // Função objetivo: Máximizar os valores dos itens na mochila
-        IloExpr obj(env);
-        for (int i = 0; i < NUM_ITENS; i++) {
-            obj += VALORES[i] * x[i];
+    // Restrições: Limite de peso
+    const int peso = mb.addRow(-IloInfinity, (IloNum)d.capacidade);
+    for (int i = 0; i < NUM_ITENS; i++) {
+        mb.addCoef(peso, x + i, (IloNum)d.peso[i]);
+    }
+    mb.extract(model, IloObjective::Maximize);
+    // Resolver
+    IloCplex cplex(model);
+    result.buildTime = timer.lap();
+    if (!solveModel(cplex, opts, result)) {
+        return false;
+    }
+    IloNumArray valores(env);
+    cplex.getValues(valores, mb.vars());
+    itens.clear();
+    for (int i = 0; i < NUM_ITENS; i++) {
+        if (valores[x + i] > 0.5) { // Se o item foi incluído
+            itens.push_back(i);
         }
-        model.add(IloMaximize(env, obj));
-        obj.end();
+    }
+    valores.end();
+    return true;
+}
+
+// Programação dinâmica ("dp") ou minknap ("minknap", respeita o limite de tempo das opções)
+static KnapsackResult solveNative(const KnapsackData &d, const string &method, const ProblemOptions &opts,
+                                  ProblemResult &result) {
+    Timer timer;
+    KnapsackResult r = method == "dp" ? knapsackDP(d) : knapsackMinknap(d, opts.timeLimit);
+    result.solveTime = timer.lap();
+    result.status = r.optimal ? "Optimal" : "Feasible";
+    result.objective = r.value;
+    result.nodes = r.states;
+    result.gap = r.optimal || r.value == 0 ? 0 : (double)(r.upperBound - r.value) / r.value;
+    return r;
+}
+
+static void printKnapsack(const KnapsackData &d, double valor, const vector<int> &itens) {
+    cout << "Solução ótima = " << valor << endl;
+    // Itens incluídos na mochila
+    for (size_t k = 0; k < itens.size() && k < (size_t)MAX_DETALHES; k++) {
+        int i = itens[k];
+        cout << "Item incluído: " << i << " Valor: "<< d.valor[i] << " Peso: "<< d.peso[i] << endl;
+    }
+}
+
+// Métodos (opts.method): "cplex" (padrão), "dp" (programação dinâmica), "minknap" ou
+// "check", que resolve pelos dois nativos e pelo CPLEX e compara os valores
+ProblemResult KnapsackProblem(const ProblemOptions &opts) {
+    ProblemResult result;
+    IloEnv env;
+    try {
+        Timer timer;
+        // Dados
+        const KnapsackData d = loadKnapsack(opts);
+        result.loadTime = timer.lap();
 
-        // Restrições: Limite de peso
-        IloExpr pesoExpr(env);
-        for (int i = 0; i < NUM_ITENS; i++) {
-            pesoExpr += PESOS[i] * x[i];
+        if (opts.method == "dp" || opts.method == "minknap") {
+            KnapsackResult r = solveNative(d, opts.method, opts, result);
+            if (!opts.quiet) {
+                printKnapsack(d, r.value, r.items);
+                cout << "Limite de Dantzig " << r.upperBound;
+                if (opts.method == "minknap") cout << ", " << r.states << " estados do minknap";
+                cout << endl;
+            }
         }
-        model.add(pesoExpr <= CAPACIDADE_MOCHILA);
-        pesoExpr.end();
-        // Resolver
-        IloCplex cplex(model);
-        if (!cplex.solve()) {
-            env.error() << "Falha ao resolver o modelo" << endl;
-            throw(-1);
+        else if (opts.method == "check") {
+            ProblemResult nativo;
+            KnapsackResult core = solveNative(d, "minknap", opts, nativo);
+            vector<KnapsackResult> nativos = {core};
+            if (fitsKnapsackDP(d)) {
+                nativos.push_back(solveNative(d, "dp", opts, nativo));
+            }
+            vector<int> itens;
+            if (!solveCplex(env, d, opts, result, itens)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
+            }
+            string erro;
+            bool ok = true;
+            for (const KnapsackResult &r : nativos) {
+                if (!checkKnapsack(d, r, erro)) {
+                    ok = false;
+                }
+                else if (r.optimal && r.value != IloRound(result.objective)) {
+                    ok = false;
+                    erro = "valores diferentes (" + r.method + ")";
+                }
+                if (!ok) break;
+            }
+            if (!ok) {
+                cerr << "Verificação da mochila falhou: " << erro << endl;
+                result.status = "Mismatch";
+            }
+            if (!opts.quiet) {
+                printKnapsack(d, result.objective, itens);
+                cout << "Minknap = " << core.value << " (" << core.states << " estados)";
+                if (nativos.size() > 1) cout << ", programação dinâmica = " << nativos[1].value;
+                cout << ", CPLEX = " << result.objective << " (" << result.solveTime << " s): " << (ok ? "ok" : erro)
+                     << endl;
+            }
         }
-        
-        // Resultados
-        cout << "Solução ótima = " << cplex.getObjValue() << endl;
-        // Itens incluídos na mochila
-        for (int i = 0; i < NUM_ITENS; i++) {
-            if (cplex.getValue(x[i]) > 0.5) { // Se o item foi incluído
-                cout << "Item incluído: " << i << " Valor: "<< VALORES[i] << " Peso: "<< PESOS[i] << endl;
+        else if (opts.method == "cplex") {
+            vector<int> itens;
+            if (!solveCplex(env, d, opts, result, itens)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
+            }
+            if (!opts.quiet) {
+                printKnapsack(d, result.objective, itens);
             }
         }
-        
+        else {
+            throw runtime_error("método desconhecido para KnapsackProblem: " + opts.method);
+        }
     }
     catch (IloException& e) {
         cerr << "Erro CPLEX: " << e << endl;
     }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
     catch (...) {
         cerr << "Erro desconhecido" << endl;
     }
     env.end();
-    return 0;
-}
\ No newline at end of file
+    return result;
+}
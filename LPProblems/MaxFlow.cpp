@@ -0,0 +1,291 @@
+#include "MaxFlow.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+
+using namespace std;
+
+MaxFlowSolver::MaxFlowSolver(const FlowNetwork &g) : g(g), n(g.n), s(g.origem), t(g.destino) {
+    if (s == t) throw runtime_error("origem e destino iguais");
+
+    // Cada arco da entrada vira um par (direto, reverso) em CSR
+    start.assign(n + 1, 0);
+    for (const Arc &a : g.arcs) {
+        if (a.from == a.to) continue;
+        start[a.from + 1]++;
+        start[a.to + 1]++;
+    }
+    for (int v = 0; v < n; v++) start[v + 1] += start[v];
+    head.resize(start[n]);
+    rev.resize(start[n]);
+    res.resize(start[n]);
+    arcOf.assign(g.arcs.size(), -1);
+
+    vector<int> pos(start.begin(), start.end() - 1);
+    for (size_t k = 0; k < g.arcs.size(); k++) {
+        const Arc &a = g.arcs[k];
+        if (a.from == a.to) continue;
+        int e1 = pos[a.from]++, e2 = pos[a.to]++;
+        head[e1] = a.to;
+        head[e2] = a.from;
+        rev[e1] = e2;
+        rev[e2] = e1;
+        arcOf[k] = e1;
+    }
+}
+
+void MaxFlowSolver::reset() {
+    fill(res.begin(), res.end(), 0);
+    for (size_t k = 0; k < g.arcs.size(); k++) {
+        if (arcOf[k] >= 0) res[arcOf[k]] += g.arcs[k].capacity;
+    }
+}
+
+MaxFlowResult MaxFlowSolver::collect(long long value) {
+    MaxFlowResult r;
+    r.value = value;
+    r.flow.assign(g.arcs.size(), 0);
+    for (size_t k = 0; k < g.arcs.size(); k++) {
+        if (arcOf[k] >= 0) r.flow[k] = g.arcs[k].capacity - res[arcOf[k]];
+    }
+
+    // Corte mínimo: vértices alcançáveis a partir da origem no grafo residual
+    r.sourceSide.assign(n, 0);
+    vector<int> fila = {s};
+    r.sourceSide[s] = 1;
+    for (size_t i = 0; i < fila.size(); i++) {
+        int u = fila[i];
+        for (int e = start[u]; e < start[u + 1]; e++) {
+            if (res[e] > 0 && !r.sourceSide[head[e]]) {
+                r.sourceSide[head[e]] = 1;
+                fila.push_back(head[e]);
+            }
+        }
+    }
+    for (size_t k = 0; k < g.arcs.size(); k++) {
+        if (r.sourceSide[g.arcs[k].from] && !r.sourceSide[g.arcs[k].to]) r.cutArcs.push_back(k);
+    }
+    return r;
+}
+
+// Dinic
+
+bool MaxFlowSolver::bfsLevels() {
+    fill(level.begin(), level.end(), -1);
+    fila.clear();
+    fila.push_back(s);
+    level[s] = 0;
+    for (size_t i = 0; i < fila.size(); i++) {
+        int u = fila[i];
+        if (u == t) break;
+        for (int e = start[u]; e < start[u + 1]; e++) {
+            int v = head[e];
+            if (res[e] > 0 && level[v] < 0) {
+                level[v] = level[u] + 1;
+                fila.push_back(v);
+            }
+        }
+    }
+    return level[t] >= 0;
+}
+
+long long MaxFlowSolver::blockingFlow() {
+    long long total = 0;
+    vector<int> caminho;  // Arcos do caminho atual a partir da origem
+    int u = s;
+    while (true) {
+        if (u == t) {
+            // Aumenta pelo gargalo e volta até a cauda do primeiro arco saturado
+            int gargalo = INT_MAX, corte = 0;
+            for (size_t i = 0; i < caminho.size(); i++) {
+                if (res[caminho[i]] < gargalo) {
+                    gargalo = res[caminho[i]];
+                    corte = i;
+                }
+            }
+            for (int e : caminho) {
+                res[e] -= gargalo;
+                res[rev[e]] += gargalo;
+            }
+            total += gargalo;
+            caminho.resize(corte);
+            u = caminho.empty() ? s : head[caminho.back()];
+            continue;
+        }
+        int &e = current[u];
+        while (e < start[u + 1] && !(res[e] > 0 && level[head[e]] == level[u] + 1)) e++;
+        if (e < start[u + 1]) {
+            caminho.push_back(e);
+            u = head[e];
+        }
+        else {
+            // Beco sem saída: remove u do grafo de níveis e recua
+            level[u] = -1;
+            if (u == s) break;
+            caminho.pop_back();
+            u = caminho.empty() ? s : head[caminho.back()];
+            current[u]++;
+        }
+    }
+    return total;
+}
+
+MaxFlowResult MaxFlowSolver::dinic() {
+    reset();
+    level.assign(n, -1);
+    long long value = 0;
+    while (bfsLevels()) {
+        current.assign(start.begin(), start.end() - 1);
+        value += blockingFlow();
+    }
+    return collect(value);
+}
+
+// Push-relabel
+
+// Rótulos exatos: distância até "target" no grafo residual, sem passar por "excluded".
+// Vértices que não alcançam "target" ficam com o rótulo limite (inativos).
+void MaxFlowSolver::globalRelabel(int target, int excluded) {
+    const int limite = buckets.size();
+    fill(height.begin(), height.end(), limite);
+    fila.clear();
+    fila.push_back(target);
+    height[target] = 0;
+    for (size_t i = 0; i < fila.size(); i++) {
+        int u = fila[i];
+        for (int e = start[u]; e < start[u + 1]; e++) {
+            int v = head[e];
+            if (res[rev[e]] > 0 && height[v] == limite && v != excluded && v != s) {
+                height[v] = height[u] + 1;
+                fila.push_back(v);
+            }
+        }
+    }
+    if (target != s) height[s] = n;
+
+    fill(count.begin(), count.end(), 0);
+    for (auto &b : buckets) b.clear();
+    for (int v = 0; v < n; v++) {
+        if (height[v] < limite) count[height[v]]++;
+        if (v != s && v != t && excess[v] > 0 && height[v] < limite) buckets[height[v]].push_back(v);
+    }
+    current.assign(start.begin(), start.end() - 1);
+    relabels = 0;
+}
+
+void MaxFlowSolver::discharge(int target, int excluded, bool gap) {
+    const int limite = buckets.size();
+    globalRelabel(target, excluded);
+    int maior = limite - 1;
+    while (true) {
+        while (maior >= 0 && buckets[maior].empty()) maior--;
+        if (maior < 0) break;
+        int u = buckets[maior].back();
+        buckets[maior].pop_back();
+        if (height[u] != maior || excess[u] == 0) continue;  // Entrada obsoleta
+
+        while (excess[u] > 0) {
+            if (current[u] == start[u + 1]) {
+                // Re-rotulação
+                int antigo = height[u], novo = limite;
+                for (int e = start[u]; e < start[u + 1]; e++) {
+                    if (res[e] > 0 && head[e] != excluded) novo = min(novo, height[head[e]] + 1);
+                }
+                count[antigo]--;
+                if (gap && count[antigo] == 0) {
+                    // Gap: ninguém acima de "antigo" alcança mais o destino
+                    for (int v = 0; v < n; v++) {
+                        if (v != s && height[v] > antigo && height[v] < limite) {
+                            count[height[v]]--;
+                            height[v] = limite;
+                        }
+                    }
+                    novo = limite;
+                }
+                height[u] = min(novo, limite);
+                current[u] = start[u];
+                if (height[u] >= limite) break;
+                count[height[u]]++;
+                if (++relabels >= n) {
+                    globalRelabel(target, excluded);
+                    maior = limite - 1;
+                    break;
+                }
+                continue;
+            }
+            int e = current[u], v = head[e];
+            if (res[e] > 0 && v != excluded && height[u] == height[v] + 1) {
+                long long d = min<long long>(excess[u], res[e]);
+                res[e] -= d;
+                res[rev[e]] += d;
+                excess[u] -= d;
+                if (excess[v] == 0 && v != target && v != s) {
+                    buckets[height[v]].push_back(v);
+                    maior = max(maior, height[v]);  // u pode ter subido acima de "maior"
+                }
+                excess[v] += d;
+            }
+            else {
+                current[u]++;
+            }
+        }
+    }
+}
+
+MaxFlowResult MaxFlowSolver::pushRelabel() {
+    reset();
+    excess.assign(n, 0);
+    height.assign(n, 0);
+
+    // Fase 1: pré-fluxo máximo, saturando os arcos da origem
+    for (int e = start[s]; e < start[s + 1]; e++) {
+        if (res[e] > 0) {
+            excess[head[e]] += res[e];
+            res[rev[e]] += res[e];
+            res[e] = 0;
+        }
+    }
+    buckets.assign(n, {});
+    count.assign(n + 1, 0);
+    discharge(t, -1, true);
+    long long value = excess[t];
+
+    // Fase 2: o excesso preso volta para a origem (rótulos até 2n, sem entrar no destino)
+    buckets.assign(2 * n, {});
+    count.assign(2 * n + 1, 0);
+    discharge(s, t, false);
+
+    buckets.clear();
+    return collect(value);
+}
+
+bool checkMaxFlow(const FlowNetwork &g, const MaxFlowResult &r, string &erro) {
+    vector<long long> saldo(g.n, 0);
+    for (size_t k = 0; k < g.arcs.size(); k++) {
+        const Arc &a = g.arcs[k];
+        if (r.flow[k] < 0 || r.flow[k] > a.capacity) {
+            erro = "fluxo fora da capacidade no arco " + to_string(k + 1);
+            return false;
+        }
+        saldo[a.from] -= r.flow[k];
+        saldo[a.to] += r.flow[k];
+    }
+    for (int v = 0; v < g.n; v++) {
+        if (v != g.origem && v != g.destino && saldo[v] != 0) {
+            erro = "conservação violada no vértice " + to_string(v + 1);
+            return false;
+        }
+    }
+    if (-saldo[g.origem] != r.value) {
+        erro = "fluxo líquido da origem diferente do valor";
+        return false;
+    }
+    long long corte = 0;
+    for (int k : r.cutArcs) corte += g.arcs[k].capacity;
+    if (!r.sourceSide[g.origem] || r.sourceSide[g.destino] || corte != r.value) {
+        erro = "capacidade do corte (" + to_string(corte) + ") diferente do valor";
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,58 @@
+// LPProblems/MaxFlow.hpp
+// Fluxo máximo nativo (sem CPLEX) sobre a rede residual em formato CSR.
+//
+// - Dinic: fases de BFS por níveis e fluxo bloqueante com DFS iterativa (sem recursão,
+//   para caminhos longos em redes grandes).
+// - Push-relabel: nó ativo de maior rótulo, com re-rotulação global (BFS reversa a partir
+//   do destino a cada n re-rotulações) e heurística de gap. A primeira fase calcula o
+//   pré-fluxo máximo; a segunda devolve o excesso restante à origem para obter um fluxo.
+//
+// Os dois devolvem o valor, o fluxo de cada arco da entrada e o corte mínimo (vértices
+// alcançáveis a partir da origem no grafo residual final).
+#ifndef MAXFLOW_HPP
+#define MAXFLOW_HPP
+#include <string>
+#include <vector>
+#include "Instances.hpp"
+
+struct MaxFlowResult {
+    long long value = 0;
+    std::vector<int> flow;         // Fluxo em cada arco de FlowNetwork::arcs
+    std::vector<char> sourceSide;  // 1 se o vértice está do lado da origem no corte mínimo
+    std::vector<int> cutArcs;      // Arcos saturados que cruzam o corte
+};
+
+class MaxFlowSolver {
+public:
+    explicit MaxFlowSolver(const FlowNetwork &g);
+
+    MaxFlowResult dinic();
+    MaxFlowResult pushRelabel();
+
+private:
+    void reset();
+    MaxFlowResult collect(long long value);
+    bool bfsLevels();
+    long long blockingFlow();
+    void globalRelabel(int target, int excluded);
+    void discharge(int target, int excluded, bool gap);
+
+    const FlowNetwork &g;
+    int n, s, t;
+    std::vector<int> start;  // Arcos residuais do vértice v: [start[v], start[v+1])
+    std::vector<int> head;   // Destino de cada arco residual
+    std::vector<int> rev;    // Arco reverso
+    std::vector<int> res;    // Capacidade residual
+    std::vector<int> arcOf;  // Posição do arco direto de cada arco da entrada (-1: laço)
+
+    // Estado dos algoritmos
+    std::vector<int> level, current, height, count, fila;
+    std::vector<long long> excess;
+    std::vector<std::vector<int>> buckets;
+    long long relabels = 0;
+};
+
+// Verifica capacidades, conservação e se a capacidade do corte é igual ao valor do fluxo
+bool checkMaxFlow(const FlowNetwork &g, const MaxFlowResult &r, std::string &erro);
+
+#endif
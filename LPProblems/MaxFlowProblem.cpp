@@ -1,113 +1,157 @@
 #include <ilcplex/ilocplex.h>
 #include <vector>
 #include <iostream>
+#include <stdexcept>
+#include "Problems.hpp"
+#include "MaxFlow.hpp"
+#include "ModelBuilder.hpp"
 ILOSTLBEGIN
 
-struct Edge {
-    int from;
-    int to;
-    int capacity;
-};
+// Modelo CPLEX: uma variável por arco; devolve o fluxo de cada arco em "flow"
+static bool solveCplex(IloEnv env, const FlowNetwork &g, const ProblemOptions &opts, ProblemResult &result,
+                       vector<int> &flow) {
+    Timer timer;
+    const int NUM_NOS = g.n;
+    const int NUM_ARCOS = g.arcs.size();
 
-int MaxFlowProblem() {
-    IloEnv env;
-    try {
-        // Criar modelo
-        IloModel model(env);
+    // Criar modelo
+    IloModel model(env);
+    ModelBuilder mb(env, opts);
 
-        // // Constantes de exemplo
-        // const int ORIGEM = 1;   // Nó de origem (s)
-        // //const int DESTINO = 6;     // Nó de destino (t) //nao usada
-        // const int NUM_NOS = 6; // Total de nós
+    // Variáveis de decisão: fluxo em cada arco, limitado pela capacidade
+    const int x = mb.addVars(NUM_ARCOS, 0, 0, IloNumVar::Int, [&](int a) {
+        return "x" + std::to_string(g.arcs[a].from + 1) + "_" + std::to_string(g.arcs[a].to + 1);
+    });
+    for (int a = 0; a < NUM_ARCOS; a++) {
+        mb.setBounds(x + a, 0, g.arcs[a].capacity);
+    }
+
+    // Restrições de conservação de fluxo (todos os nós exceto origem e destino): entra - sai = 0
+    std::vector<int> linha(NUM_NOS, -1);
+    for (int v = 0; v < NUM_NOS; v++) {
+        if (v != g.origem && v != g.destino) {
+            linha[v] = mb.addRow(0, 0);
+        }
+    }
+    for (int a = 0; a < NUM_ARCOS; a++) {
+        const Arc &arc = g.arcs[a];
+        if (linha[arc.from] >= 0) mb.addCoef(linha[arc.from], x + a, -1);
+        if (linha[arc.to] >= 0) mb.addCoef(linha[arc.to], x + a, 1);
+        // Função objetivo: maximizar o fluxo líquido que sai da origem
+        double liquido = (arc.from == g.origem) - (arc.to == g.origem);
+        if (liquido != 0) mb.setObjective(x + a, liquido);
+    }
+    mb.extract(model, IloObjective::Maximize);
 
-        // // Lista de arestas (dutos) com capacidades
-        // std::vector<Edge> EDGES = {
-        //     {1, 2, 16},  // s → 2
-        //     {1, 3, 13},  // s → 3
-            
-        //     {2, 3, 10},  // 2 → 3
-        //     {2, 4, 12},  // 2 → 4
-        //     {3, 5, 14},  // 3 → 5
-            
-        //     {4, 3, 9},   // 4 → 3
-        //     {4, 6, 20},  // 4 → t
-        //     {5, 4, 7},   // 5 → 4
-        //     {5, 6, 4},   // 5 → t
-        // };
+    // Resolver
+    IloCplex cplex(model);
+    result.buildTime = timer.lap();
+    if (!solveModel(cplex, opts, result)) {
+        return false;
+    }
+    IloNumArray valores(env);
+    cplex.getValues(valores, mb.vars());
+    flow.assign(NUM_ARCOS, 0);
+    for (int a = 0; a < NUM_ARCOS; a++) {
+        flow[a] = IloRound(valores[x + a]);
+    }
+    valores.end();
+    return true;
+}
 
-        const int ORIGEM = 1;   // Nó de origem (s)
-        // const int DESTINO = 4;     // Nó de destino (t) //nao usada
-        const int NUM_NOS = 4; // Total de nós
+// Algoritmo nativo ("dinic" ou "pushrelabel")
+static MaxFlowResult solveNative(const FlowNetwork &g, const string &method, ProblemResult &result) {
+    Timer timer;
+    MaxFlowSolver solver(g);
+    result.buildTime = timer.lap();
+    MaxFlowResult r = method == "dinic" ? solver.dinic() : solver.pushRelabel();
+    result.solveTime = timer.lap();
+    result.status = "Optimal";
+    result.objective = r.value;
+    result.nodes = 0;
+    return r;
+}
 
-        std::vector<Edge> EDGES = {
-                {1, 2, 10},
-                {1, 3, 5},
-                {2, 3, 15},
-                {2, 4, 8},
-                {3, 4, 10}
-            };
+static void printFlow(const FlowNetwork &g, double value, const vector<int> &flow) {
+    const int NUM_ARCOS = g.arcs.size();
+    cout << "Solução ótima = " << value << endl;
+    // Exibir a solução como lista de adjacências (arcos com fluxo)
+    int mostrados = 0;
+    for (int a = 0; a < NUM_ARCOS && mostrados < MAX_DETALHES; a++) {
+        if (flow[a] > 0 || NUM_ARCOS <= MAX_DETALHES) {
+            cout << g.arcs[a].from + 1 << " -> " << g.arcs[a].to + 1 << " : " << flow[a] << endl;
+            mostrados++;
+        }
+    }
+}
 
+// Métodos (opts.method): "cplex" (padrão), "dinic", "pushrelabel" ou "check", que resolve
+// pelos três e confere valores e certificados (fluxo viável e corte de mesma capacidade)
+ProblemResult MaxFlowProblem(const ProblemOptions &opts) {
+    ProblemResult result;
+    IloEnv env;
+    try {
+        Timer timer;
+        // Dados
+        const FlowNetwork g = loadMaxFlow(opts);
+        result.loadTime = timer.lap();
 
-        // Variáveis de decisão
-        IloArray<IloIntVarArray> x(env, NUM_NOS + 1);
-        for (int i = 0; i < NUM_NOS; i++) {
-            x[i] = IloIntVarArray(env, NUM_NOS + 1, 0, 1000); // Limite superior arbitrário
-            for (int j = 0; j < NUM_NOS; j++) {
-                if(i != j)
-                    x[i][j].setName(("x" + std::to_string(i) + std::to_string(j)).c_str());
+        if (opts.method == "dinic" || opts.method == "pushrelabel") {
+            MaxFlowResult r = solveNative(g, opts.method, result);
+            if (!opts.quiet) {
+                printFlow(g, r.value, r.flow);
+                cout << "Corte mínimo: " << r.cutArcs.size() << " arcos" << endl;
             }
         }
-        // Função objetivo: maximizar o fluxo
-        IloExpr obj(env);
-        for (const auto& edge : EDGES) {
-            if (edge.from == ORIGEM) {
-                obj += x[edge.from][edge.to];
+        else if (opts.method == "check") {
+            ProblemResult dinic, pushRelabel;
+            MaxFlowResult rd = solveNative(g, "dinic", dinic);
+            MaxFlowResult rp = solveNative(g, "pushrelabel", pushRelabel);
+            vector<int> flow;
+            if (!solveCplex(env, g, opts, result, flow)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
             }
-        }
-        model.add(IloMaximize(env, obj));        
-        obj.end();
-        // Restrições de capacidade
-        for (const auto& edge : EDGES) {
-            model.add(x[edge.from][edge.to] <= edge.capacity);
-        }
-        // Restrições de conservação de fluxo
-        for (int i = ORIGEM + 1; i < NUM_NOS; i++) { // Ignora origem e destino
-            IloExpr in(env);
-            IloExpr out(env);
-            for (const auto& edge : EDGES) {
-                if (edge.from == i) {
-                    out += x[edge.from][edge.to];
-                }
-                if (edge.to == i) {
-                    in += x[edge.from][edge.to];
-                }
+            string erro;
+            bool ok = checkMaxFlow(g, rd, erro) && checkMaxFlow(g, rp, erro);
+            if (ok && (rd.value != rp.value || rd.value != IloRound(result.objective))) {
+                ok = false;
+                erro = "valores diferentes";
+            }
+            if (!ok) {
+                cerr << "Verificação do fluxo máximo falhou: " << erro << endl;
+                result.status = "Mismatch";
+            }
+            if (!opts.quiet) {
+                printFlow(g, result.objective, flow);
+                cout << "Dinic = " << rd.value << " (" << dinic.solveTime << " s), push-relabel = " << rp.value
+                     << " (" << pushRelabel.solveTime << " s), CPLEX = " << result.objective << " ("
+                     << result.solveTime << " s): " << (ok ? "ok" : erro) << endl;
             }
-            model.add(in == out);
-            in.end();
-            out.end();
         }
-        // Resolver
-        IloCplex cplex(model);
-        if (!cplex.solve()) {
-            env.error() << "Falha ao resolver o modelo" << endl;
-            throw(-1);
+        else if (opts.method == "cplex") {
+            vector<int> flow;
+            if (!solveCplex(env, g, opts, result, flow)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
+            }
+            if (!opts.quiet) {
+                printFlow(g, result.objective, flow);
+            }
         }
-        
-        // Resultados
-        cout << "Solução ótima = " << cplex.getObjValue() << endl;
-        // Exibir a solução como lista de adjacências
-        for (const auto& edge : EDGES) {
-            double flow = cplex.getValue(x[edge.from][edge.to]);
-            cout << edge.from << " -> " << edge.to << " : " << flow << endl;
+        else {
+            throw runtime_error("método desconhecido para MaxFlowProblem: " + opts.method);
         }
-        
     }
     catch (IloException& e) {
         cerr << "Erro CPLEX: " << e << endl;
     }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
     catch (...) {
         cerr << "Erro desconhecido" << endl;
     }
     env.end();
-    return 0;
-}
\ No newline at end of file
+    return result;
+}
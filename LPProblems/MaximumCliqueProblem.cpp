@@ -1,80 +1,147 @@
 #include <ilcplex/ilocplex.h>
 #include <vector>
 #include <iostream>
+#include <stdexcept>
+#include "Problems.hpp"
+#include "Clique.hpp"
+#include "ModelBuilder.hpp"
 ILOSTLBEGIN
 
-struct Edge {
-    int from;
-    int to;
-};
+// Modelo CPLEX com desigualdades de cobertura por conjuntos independentes: no máximo um
+// vértice de cada conjunto independente entra na clique. Cada par não adjacente está em
+// algum conjunto, então o modelo é válido, e cada conjunto maximal substitui de uma vez
+// as O(n²) restrições x[i] + x[j] <= 1 dos seus pares, com um limite de LP bem mais forte.
+static bool solveCplex(IloEnv env, const Graph &g, const ProblemOptions &opts, ProblemResult &result,
+                       vector<int> &clique) {
+    Timer timer;
+    const int NUM_NOS = g.n;
 
-int MaximumCliqueProblem() {
-    IloEnv env;
-    try {
-        // Criar modelo
-        IloModel model(env);
-
-        //Constantes
-        const std::vector<Edge> EDGES = {
-            {0, 1}, {0, 2}, {0, 3}, {0, 4},
-            {1, 2}, {1, 5}, {1, 6},
-            {2, 3}, {2, 7},
-            {3, 4}, {3, 8}, {3, 9},
-            {4, 9}, {4, 10},
-            {5, 6}, {5, 7}, {5, 11},
-            {6, 7}, {6, 11},
-            {7, 8}, {7, 11},
-            {8, 9}, {8, 11},
-            {9, 10}, {9, 11},
-            {10, 11}
-        };
-        const int NUM_NOS = 12;
+    // Criar modelo
+    IloModel model(env);
+    ModelBuilder mb(env, opts);
 
-        vector<vector<int>> adj(NUM_NOS, vector<int>(NUM_NOS, 0));
-        for (const auto& e : EDGES) {
-            adj[e.from][e.to] = 1;
-            adj[e.to][e.from] = 1;
+    // Variáveis de decisão
+    // Vértices que fazem ou não parte da clique
+    const int x = mb.addVars(NUM_NOS, 0, 1, IloNumVar::Int, [](int i) { return "Vértice " + std::to_string(i); });
+    // Função objetivo: Maximizar os vértices que fazem parte da clique
+    for (int i = 0; i < NUM_NOS; i++) {
+        mb.setObjective(x + i, 1);
+    }
+    // Restrições: no máximo um vértice de cada conjunto independente
+    for (const auto &conjunto : independentSetCover(g)) {
+        const int linha = mb.addRow(-IloInfinity, 1);
+        for (int v : conjunto) {
+            mb.addCoef(linha, x + v, 1);
         }
-
-        // Variáveis de decisão
-        // Vértices que fazem ou não parte da clique
-        IloIntVarArray x(env, NUM_NOS, 0, 1);
-        for (int i = 0; i < NUM_NOS; i++) {
-            x[i].setName(("Vértice " + std::to_string(i) ).c_str());
+    }
+    mb.extract(model, IloObjective::Maximize);
+    // Resolver
+    IloCplex cplex(model);
+    result.buildTime = timer.lap();
+    if (!solveModel(cplex, opts, result)) {
+        return false;
+    }
+    IloNumArray valores(env);
+    cplex.getValues(valores, mb.vars());
+    clique.clear();
+    for (int i = 0; i < NUM_NOS; i++) {
+        if (valores[x + i] > 0.5) {
+            clique.push_back(i);
         }
-        // Função objetivo: Maximizar os vértices que fazem parte da clique
-        model.add(IloMaximize(env, IloSum(x)));
-        // Restrições: Para cada dois vértices não adjacentes, pelo menos um deles não pode fazer parte da clique
-        for (int i = 0; i < NUM_NOS; i++) {
-            for (int j = i + 1; j < NUM_NOS; j++) {
-                if (adj[i][j] == 0) {
-                    model.add(x[i] + x[j] <= 1);
-                }
+    }
+    valores.end();
+    return true;
+}
+
+// Branch-and-bound nativo com bitsets (respeita o limite de tempo das opções)
+static CliqueResult solveNative(const Graph &g, const ProblemOptions &opts, ProblemResult &result) {
+    Timer timer;
+    MaxCliqueSolver solver(g);
+    result.buildTime = timer.lap();
+    CliqueResult r = solver.solve(opts.timeLimit);
+    result.solveTime = timer.lap();
+    result.status = r.optimal ? "Optimal" : "Feasible";
+    result.objective = r.clique.size();
+    result.nodes = r.nodes;
+    result.gap = r.optimal ? 0 : (double)(r.upperBound - (int)r.clique.size()) / r.upperBound;
+    return r;
+}
+
+static void printClique(const vector<int> &clique) {
+    cout << "Solução ótima = " << clique.size() << endl;
+    cout << "Vértices na clique: " << clique.size() << endl;
+    for (size_t k = 0; k < clique.size() && k < (size_t)MAX_DETALHES; k++) {
+        cout << "\tVértice " << clique[k] << " faz parte da clique" << endl;
+    }
+}
+
+// Métodos (opts.method): "cplex" (padrão), "bnb" (nativo) ou "check", que resolve pelos
+// dois, confere a clique do nativo e compara os tamanhos
+ProblemResult MaximumCliqueProblem(const ProblemOptions &opts) {
+    ProblemResult result;
+    IloEnv env;
+    try {
+        Timer timer;
+        // Dados
+        const Graph g = loadCliqueGraph(opts);
+        result.loadTime = timer.lap();
+
+        if (opts.method == "bnb") {
+            CliqueResult r = solveNative(g, opts, result);
+            if (!opts.quiet) {
+                printClique(r.clique);
+                cout << "Clique gulosa " << r.heuristic << ", limite da coloração " << r.upperBound << ", "
+                     << r.pruned << " vértices removidos pelo núcleo, " << r.nodes << " nós" << endl;
             }
         }
-        // Resolver
-        IloCplex cplex(model);
-        if (!cplex.solve()) {
-            env.error() << "Falha ao resolver o modelo" << endl;
-            throw(-1);
+        else if (opts.method == "check") {
+            ProblemResult nativo;
+            CliqueResult r = solveNative(g, opts, nativo);
+            vector<int> clique;
+            if (!solveCplex(env, g, opts, result, clique)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
+            }
+            string erro;
+            bool ok = checkClique(g, r.clique, erro) && checkClique(g, clique, erro);
+            if (ok && r.optimal && (int)r.clique.size() != IloRound(result.objective)) {
+                ok = false;
+                erro = "tamanhos diferentes";
+            }
+            if (!ok) {
+                cerr << "Verificação da clique falhou: " << erro << endl;
+                result.status = "Mismatch";
+            }
+            if (!opts.quiet) {
+                printClique(clique);
+                cout << "Branch-and-bound = " << r.clique.size() << " (" << nativo.solveTime << " s, " << r.nodes
+                     << " nós), CPLEX = " << result.objective << " (" << result.solveTime
+                     << " s): " << (ok ? "ok" : erro) << endl;
+            }
         }
-        
-        // Resultados
-        cout << "Solução ótima = " << cplex.getObjValue() << endl;
-        cout << "Vértices na clique: " <<  cplex.getObjValue() << endl;
-        for (int i = 0; i < NUM_NOS; i++) {
-            if (cplex.getValue(x[i]) > 0.5) {
-                cout << "\t" << x[i].getName() << " faz parte da clique" << endl;
+        else if (opts.method == "cplex") {
+            vector<int> clique;
+            if (!solveCplex(env, g, opts, result, clique)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
+            }
+            if (!opts.quiet) {
+                printClique(clique);
             }
         }
-        
+        else {
+            throw runtime_error("método desconhecido para MaximumCliqueProblem: " + opts.method);
+        }
     }
     catch (IloException& e) {
         cerr << "Erro CPLEX: " << e << endl;
     }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
     catch (...) {
         cerr << "Erro desconhecido" << endl;
     }
     env.end();
-    return 0;
-}
\ No newline at end of file
+    return result;
+}
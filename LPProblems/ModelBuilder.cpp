@@ -0,0 +1,115 @@
+#include "ModelBuilder.hpp"
+
+ILOSTLBEGIN
+
+ModelBuilder::ModelBuilder(IloEnv env, const ProblemOptions &opts) : env(env), nomes(!opts.lean) {}
+
+int ModelBuilder::addVars(int count, double lb, double ub, IloNumVar::Type type,
+                          const function<string(int)> &name) {
+    const int inicio = limInf.size();
+    blocos.push_back({inicio, count, type, nomes ? name : nullptr});
+    limInf.resize(inicio + count, lb);
+    limSup.resize(inicio + count, ub);
+    objetivo.resize(inicio + count, 0);
+    return inicio;
+}
+
+void ModelBuilder::setBounds(int var, double lb, double ub) {
+    limInf[var] = lb;
+    limSup[var] = ub;
+}
+
+void ModelBuilder::setObjective(int var, double coef) {
+    objetivo[var] = coef;
+}
+
+int ModelBuilder::addRow(double lb, double ub) {
+    linhaInf.push_back(lb);
+    linhaSup.push_back(ub);
+    return linhaInf.size() - 1;
+}
+
+void ModelBuilder::addCoef(int row, int var, double coef) {
+    nzLinha.push_back(row);
+    nzVar.push_back(var);
+    nzCoef.push_back(coef);
+}
+
+int ModelBuilder::addRow(double lb, double ub, const vector<int> &vars, double coef) {
+    int row = addRow(lb, ub);
+    for (int v : vars) addCoef(row, v, coef);
+    return row;
+}
+
+void ModelBuilder::extract(IloModel model, IloObjective::Sense sense) {
+    const int n = limInf.size(), m = linhaInf.size();
+
+    // Variáveis, um IloNumVarArray por bloco
+    variaveis = IloNumVarArray(env);
+    for (const Bloco &b : blocos) {
+        IloNumArray lb(env, b.tamanho), ub(env, b.tamanho);
+        for (int k = 0; k < b.tamanho; k++) {
+            lb[k] = limInf[b.inicio + k];
+            ub[k] = limSup[b.inicio + k];
+        }
+        variaveis.add(IloNumVarArray(env, lb, ub, b.tipo));
+        lb.end();
+        ub.end();
+        if (b.nome) {
+            for (int k = 0; k < b.tamanho; k++) variaveis[b.inicio + k].setName(b.nome(k).c_str());
+        }
+    }
+
+    // Objetivo
+    IloObjective obj(env, 0, sense);
+    IloNumArray c(env, n);
+    for (int k = 0; k < n; k++) c[k] = objetivo[k];
+    obj.setLinearCoefs(variaveis, c);
+    c.end();
+    model.add(obj);
+
+    // Triplas agrupadas por linha
+    vector<int> inicio(m + 1, 0);
+    for (int r : nzLinha) inicio[r + 1]++;
+    for (int r = 0; r < m; r++) inicio[r + 1] += inicio[r];
+    vector<int> var(nzVar.size());
+    vector<double> coef(nzVar.size());
+    {
+        vector<int> pos(inicio.begin(), inicio.end() - 1);
+        for (size_t k = 0; k < nzVar.size(); k++) {
+            int p = pos[nzLinha[k]]++;
+            var[p] = nzVar[k];
+            coef[p] = nzCoef[k];
+        }
+    }
+
+    IloNumArray lb(env, m), ub(env, m);
+    for (int r = 0; r < m; r++) {
+        lb[r] = linhaInf[r];
+        ub[r] = linhaSup[r];
+    }
+    linhas = IloRangeArray(env, lb, ub);
+    lb.end();
+    ub.end();
+    vector<int> posicao(n, -1);  // Posição da variável na linha atual (repetidas somam)
+    IloNumVarArray v(env);
+    IloNumArray a(env);
+    for (int r = 0; r < m; r++) {
+        v.clear();
+        a.clear();
+        for (int k = inicio[r]; k < inicio[r + 1]; k++) {
+            if (posicao[var[k]] >= 0) {
+                a[posicao[var[k]]] += coef[k];
+                continue;
+            }
+            posicao[var[k]] = v.getSize();
+            v.add(variaveis[var[k]]);
+            a.add(coef[k]);
+        }
+        for (int k = inicio[r]; k < inicio[r + 1]; k++) posicao[var[k]] = -1;
+        linhas[r].setLinearCoefs(v, a);
+    }
+    v.end();
+    a.end();
+    model.add(linhas);
+}
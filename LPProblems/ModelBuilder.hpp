@@ -0,0 +1,69 @@
+// LPProblems/ModelBuilder.hpp
+// Montagem de modelos CPLEX em lote, compartilhada pelos problemas.
+//
+// Variáveis, objetivo e restrições são acumulados em vetores comuns: limites por bloco de
+// variáveis, coeficientes do objetivo num vetor denso e os das restrições como triplas
+// esparsas (linha, variável, valor), sem um IloExpr por linha. "extract" cria cada bloco de
+// variáveis com um IloNumVarArray(lb, ub, tipo), o objetivo com setLinearCoefs, agrupa as
+// triplas por linha (ordenação por contagem, somando variáveis repetidas), cria todas as
+// linhas num IloRangeArray preenchido linha a linha com setLinearCoefs e entrega tudo ao
+// modelo com um model.add por parte.
+//
+// Modo enxuto (opts.lean, "-lean"): as funções de nome não são chamadas e as variáveis
+// ficam sem nome. Para comparar os tempos de construção: "solver.out -problem <nome>
+// -generate <n> -format csv" com e sem "-lean" (coluna build_time).
+#ifndef MODEL_BUILDER_HPP
+#define MODEL_BUILDER_HPP
+#include <ilcplex/ilocplex.h>
+#include <functional>
+#include <string>
+#include <vector>
+#include "Problems.hpp"
+
+class ModelBuilder {
+public:
+    ModelBuilder(IloEnv env, const ProblemOptions &opts);
+
+    // Bloco de "count" variáveis do mesmo tipo; devolve o índice da primeira. "name(k)" dá o
+    // nome da k-ésima do bloco e só é chamada fora do modo enxuto.
+    int addVars(int count, double lb, double ub, IloNumVar::Type type,
+                const std::function<std::string(int)> &name = nullptr);
+    void setBounds(int var, double lb, double ub);
+    void setObjective(int var, double coef);
+
+    // Restrição lb <= sum coef * x <= ub, com os coeficientes dados por addCoef; devolve o
+    // índice da linha
+    int addRow(double lb, double ub);
+    void addCoef(int row, int var, double coef);
+    // Atalho: linha com a mesma constante "coef" em todas as variáveis de "vars"
+    int addRow(double lb, double ub, const std::vector<int> &vars, double coef = 1);
+
+    // Cria as variáveis, o objetivo e as linhas e os acrescenta ao modelo
+    void extract(IloModel model, IloObjective::Sense sense);
+
+    // Depois de extract
+    const IloNumVarArray &vars() const { return variaveis; }
+    IloNumVar var(int k) const { return variaveis[k]; }
+    const IloRangeArray &rows() const { return linhas; }
+    int numVars() const { return (int)limInf.size(); }
+    int numRows() const { return (int)linhaInf.size(); }
+
+private:
+    struct Bloco {
+        int inicio, tamanho;
+        IloNumVar::Type tipo;
+        std::function<std::string(int)> nome;
+    };
+
+    IloEnv env;
+    bool nomes;
+    std::vector<Bloco> blocos;
+    std::vector<double> limInf, limSup, objetivo;
+    std::vector<double> linhaInf, linhaSup;
+    std::vector<int> nzLinha, nzVar;
+    std::vector<double> nzCoef;
+    IloNumVarArray variaveis;
+    IloRangeArray linhas;
+};
+
+#endif
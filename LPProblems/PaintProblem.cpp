@@ -1,106 +1,94 @@
 #include <ilcplex/ilocplex.h>
 #include <iostream>
+#include "Problems.hpp"
+#include "ModelBuilder.hpp"
 ILOSTLBEGIN
 
-int PaintProblem() {
+ProblemResult PaintProblem(const ProblemOptions &opts) {
+    ProblemResult result;
     IloEnv env;
     try {
-        // Criar modelo
-        IloModel model(env);
-        // Constantes
-        const int MIN_SEC_SR = 1000 * 0.25;
-        const int MIN_COR_SR = 1000 * 0.5;
-        const int MIN_SEC_SN = 250 * 0.2;
-        const int MIN_COR_SN = 250 * 0.5;
-
-        
-        
+        Timer timer;
+        // Dados
         // Xij = Quantidade do componente i na tinta j
-        // i = {SolA, SolB, SEC, COR}
-        const int NUM_COMPONENTES = 4;
-        // j = {SR, SN}
-        const int NUM_TINTAS = 2;
+        // No exemplo: i = {SolA, SolB, SEC, COR}, j = {SR, SN}, atributos = {SEC, COR}
+        const PaintData d = loadPaint(opts);
+        result.loadTime = timer.lap();
+        const int NUM_COMPONENTES = d.numComponentes;
+        const int NUM_TINTAS = d.numTintas;
+        const int NUM_ATRIBUTOS = d.numAtributos;
 
-        const double PRECOS[NUM_COMPONENTES] = {
-            1.5, 1, 4, 6
-        };
-        const int VOLUMES[NUM_TINTAS] = {
-            1000, 250
-        };
+        // Criar modelo
+        IloModel model(env);
+        ModelBuilder mb(env, opts);
 
-        const int SEC[NUM_TINTAS] = {
-            MIN_SEC_SR, MIN_SEC_SN
-        };
-        const int COR[NUM_TINTAS] = {
-            MIN_COR_SR, MIN_COR_SN
-        };
-        // Variáveis de decisão
-        IloArray<IloIntVarArray> x(env, NUM_COMPONENTES);
+        // Variáveis de decisão: x[i][j] no índice x + i * NUM_TINTAS + j
+        const int x = mb.addVars(NUM_COMPONENTES * NUM_TINTAS, 0, 0, IloNumVar::Int, [&](int k) {
+            return "x" + std::to_string(k / NUM_TINTAS + 1) + "_" + std::to_string(k % NUM_TINTAS + 1);
+        });
         for (int i = 0; i < NUM_COMPONENTES; i++) {
-            x[i] = IloIntVarArray(env, NUM_TINTAS, 0, 1000);
             for (int j = 0; j < NUM_TINTAS; j++) {
-                x[i][j].setName(("x" + std::to_string(i + 1) + std::to_string(j + 1)).c_str());
+                mb.setBounds(x + i * NUM_TINTAS + j, 0, (IloInt)d.volume[j]);
             }
         }
         // Função objetivo: Minimizar custo
-        IloExpr custo(env);
         for (int j = 0; j < NUM_TINTAS; j++) {
             for (int i = 0; i < NUM_COMPONENTES; i++) {
-                custo += x[i][j] * PRECOS[i];
+                mb.setObjective(x + i * NUM_TINTAS + j, d.preco[i]);
             }
         }
-        model.add(IloMinimize(env, custo));
-        custo.end();
         // Restrições
         // Restrição de volume
         for (int j = 0; j < NUM_TINTAS; j++) {
-            IloExpr volume_total(env);
+            const int volume_total = mb.addRow(d.volume[j], d.volume[j]);
             for (int i = 0; i < NUM_COMPONENTES; i++) {
-                volume_total += x[i][j];
+                mb.addCoef(volume_total, x + i * NUM_TINTAS + j, 1);
             }
-            model.add(volume_total == VOLUMES[j]);
-            volume_total.end();
-        }
-        // Restrição QNTD mínima SEC
-        for (int j = 0; j < NUM_TINTAS; j++) {
-            IloExpr SEC_Total(env);
-            SEC_Total = x[0][j] * 0.3 + x[1][j] * 0.6 + x[2][j];
-            model.add(SEC_Total >= SEC[j]);
-            SEC_Total.end();
         }
-        // Restrição QNTD mínima COR
-        for (int j = 0; j < NUM_TINTAS; j++) {
-            IloExpr COR_Total(env);
-            COR_Total = x[0][j] * 0.7 + x[1][j] * 0.4 + x[3][j];
-            model.add(COR_Total >= COR[j]);
-            COR_Total.end();
+        // Restrição QNTD mínima de cada atributo (fração do volume da tinta)
+        for (int a = 0; a < NUM_ATRIBUTOS; a++) {
+            for (int j = 0; j < NUM_TINTAS; j++) {
+                const int total = mb.addRow(d.minimo[a * NUM_TINTAS + j] * d.volume[j], IloInfinity);
+                for (int i = 0; i < NUM_COMPONENTES; i++) {
+                    double teor = d.teor[a * NUM_COMPONENTES + i];
+                    if (teor != 0) mb.addCoef(total, x + i * NUM_TINTAS + j, teor);
+                }
+            }
         }
+        mb.extract(model, IloObjective::Minimize);
         // Resolver
         IloCplex cplex(model);
-        if (!cplex.solve()) {
+        result.buildTime = timer.lap();
+        if (!solveModel(cplex, opts, result)) {
             env.error() << "Falha ao resolver o modelo" << endl;
             throw(-1);
         }
         
-        // Resultados
-        cout << "Solução ótima = " << cplex.getObjValue() << endl;
-        const char* linhas[] = {"SolA", "SolB", "SEC", "COR"};
-        cout << "\tSR\tSN" << endl;
-        for (int i = 0; i < NUM_COMPONENTES; i++) {
-            cout << linhas[i]<< "\t";
-            for (int j = 0; j < NUM_TINTAS; j++) {
-                cout << cplex.getValue(x[i][j]) << "\t";
+        if (!opts.quiet) {
+            // Resultados: componentes por linha, tintas por coluna
+            cout << "Solução ótima = " << cplex.getObjValue() << endl;
+            for (int j = 0; j < NUM_TINTAS && j < MAX_DETALHES; j++) {
+                cout << "\tT" << j + 1;
             }
             cout << endl;
+            for (int i = 0; i < NUM_COMPONENTES && i < MAX_DETALHES; i++) {
+                cout << "C" << i + 1 << "\t";
+                for (int j = 0; j < NUM_TINTAS && j < MAX_DETALHES; j++) {
+                    cout << cplex.getValue(mb.var(x + i * NUM_TINTAS + j)) << "\t";
+                }
+                cout << endl;
+            }
         }
-        
     }
     catch (IloException& e) {
         cerr << "Erro CPLEX: " << e << endl;
     }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
     catch (...) {
         cerr << "Erro desconhecido" << endl;
     }
     env.end();
-    return 0;
-}
\ No newline at end of file
+    return result;
+}
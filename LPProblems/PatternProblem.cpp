@@ -1,110 +1,101 @@
 #include <ilcplex/ilocplex.h>
+#include "Problems.hpp"
+#include "ModelBuilder.hpp"
 ILOSTLBEGIN
 
-enum linhas {
-    TAM_FOLHAS,
-    NUM_CORPO,
-    NUM_TAMPA,
-    TEMPO_IMPRESSAO,
-};
-
-int PatternProblem() {
+ProblemResult PatternProblem(const ProblemOptions &opts) {
+    ProblemResult result;
     IloEnv env;
     try {
+        Timer timer;
+        // Dados: para cada padrão, o tipo de folha, os corpos, as tampas e o tempo de impressão
+        const PatternData d = loadPattern(opts);
+        result.loadTime = timer.lap();
+        const int NUM_PADROES = d.numPadroes;
+        const int NUM_TIPOS_FOLHA = d.numTiposFolha;
+
         // Criar modelo
         IloModel model(env);
-        const int NUM_PADROES = 4;
-        const int NUM_TIPOS_FOLHA = 2;
-        const int QNTD_TIPOS_FOLHA[NUM_TIPOS_FOLHA] = {200, 90};
-        const int PRECO_LATINHA = 50;
-        const int CUSTO_ESTOCAGEM_CORPO = 50;
-        const int CUSTO_TAMPA = 3;
-        const int TABELA[][NUM_PADROES] = 
-        {
-            {1, 2, 1, 1},
-            {1, 2, 0, 4},
-            {7, 3, 9, 4},
-            {2, 3, 2, 1},
-        };
+        ModelBuilder mb(env, opts);
+
+        // Variáveis de decisão: cada padrão usa uma folha do seu tipo
+        const int x = mb.addVars(NUM_PADROES, 0, 0, IloNumVar::Int, [](int i) { return "x" + std::to_string(i + 1); });
+        for (int i = 0; i < NUM_PADROES; i++) {
+            mb.setBounds(x + i, 0, d.qtdFolhas[d.folha[i] - 1]);
+        }
+        // Latinhas montadas: L = min(C, T/2), com C corpos e T tampas
+        const int L = mb.addVars(1, 0, IloInfinity, IloNumVar::Float, [](int) { return std::string("latinhas"); });
 
-        // Variáveis de decisão
-        IloIntVarArray x(env, NUM_PADROES, 0, 200);
-        
         // Função objetivo
-        // O número de latinhas vai ser o mínimo entre o somatório do número de corpos e o somatório do número de tampas/2.
-        // min(C, T/2)
-        // Com o número de latinhas, podemos calcular o custo de estocagem dos excedentes
+        // A função objetivo será o lucro com as latinhas menos os custos de estocagem
         // Corpos não usado = C - L
         // Tampas não usadas = T - 2L
-        // A função objetivo será o lucro com as latinhas menos os custos de estocagem
         // 50L - 50(C - L) - 3(T - 2L)
         // 50L - 50C + 50L - 3T + 6L
         // 106L - 50C - 3T
-        
-        // Calculando o número de corpos
-        IloExpr corpos(env);
-        for (int i = 0; i < NUM_PADROES; i++) {
-            corpos += TABELA[NUM_CORPO][i] * x[i];
-        }
-        // Calculando o número de tampas
-        IloExpr tampas(env);
+        // Como o coeficiente de L é positivo, o máximo leva L ao min(C, T/2) com as duas
+        // restrições L <= C e 2L <= T, sem o IloMin (que vira restrições lógicas no CPLEX)
+        mb.setObjective(L, d.precoLatinha + d.custoCorpo + 2 * d.custoTampa);
         for (int i = 0; i < NUM_PADROES; i++) {
-            tampas += TABELA[NUM_TAMPA][i] * x[i];
+            mb.setObjective(x + i, -d.custoCorpo * d.corpos[i] - d.custoTampa * d.tampas[i]);
         }
-        // Calculando o número de latinhas
-        IloExpr latinhas(env);
-        latinhas = IloMin(corpos, tampas / 2);
-
-        // Função objetivo
-        IloExpr lucro(env);
-        lucro = PRECO_LATINHA * latinhas - CUSTO_ESTOCAGEM_CORPO * (corpos - latinhas) - CUSTO_TAMPA * (tampas - 2 * latinhas);
-        
-        model.add(IloMaximize(env, lucro));
-        
-        corpos.end();
-        tampas.end();
-        latinhas.end();
-        lucro.end();
-
-
 
         // Restrições
-        // Folhas de metal
-        // A fábrica possui 200 folhas de metal de tam 1 e 90 de tam 2
+        // Latinhas limitadas pelos corpos e pelas tampas
+        const int corpos = mb.addRow(-IloInfinity, 0);
+        const int tampas = mb.addRow(-IloInfinity, 0);
+        mb.addCoef(corpos, L, 1);
+        mb.addCoef(tampas, L, 2);
+        for (int i = 0; i < NUM_PADROES; i++) {
+            mb.addCoef(corpos, x + i, -d.corpos[i]);
+            mb.addCoef(tampas, x + i, -d.tampas[i]);
+        }
+        // Folhas de metal disponíveis de cada tipo
+        const int folhas = mb.numRows();
         for (int i = 0; i < NUM_TIPOS_FOLHA; i++) {
-            IloExpr folhas(env);
-            for (int j = 0; j < NUM_PADROES; j++) {
-                if (TABELA[TAM_FOLHAS][j] == i+1) {
-                    folhas += x[j];
-                }
-            }
-            model.add(folhas <= QNTD_TIPOS_FOLHA[i]);
-            folhas.end();
+            mb.addRow(-IloInfinity, d.qtdFolhas[i]);
+        }
+        for (int j = 0; j < NUM_PADROES; j++) {
+            mb.addCoef(folhas + d.folha[j] - 1, x + j, 1);
         }
+        mb.extract(model, IloObjective::Maximize);
+
         // Resolver
         IloCplex cplex(model);
-        if (!cplex.solve()) {
+        result.buildTime = timer.lap();
+        if (!solveModel(cplex, opts, result)) {
             env.error() << "Falha ao resolver o modelo" << endl;
             throw(-1);
         }
         
-        // Resultados
-        cout << "Solução ótima = " << cplex.getObjValue() << endl;
-        int tempo = 0;
-        for (int i = 0; i < NUM_PADROES; i++) {
-            cout << "Quantidade padrão "<< i+1 << " = " << cplex.getValue(x[i]) << endl;
-            tempo += cplex.getValue(x[i]) * TABELA[TEMPO_IMPRESSAO][i];
+        if (!opts.quiet) {
+            // Resultados
+            cout << "Solução ótima = " << cplex.getObjValue() << endl;
+            IloNumArray valores(env);
+            cplex.getValues(valores, mb.vars());
+            long long tempo = 0;
+            for (int i = 0, mostrados = 0; i < NUM_PADROES; i++) {
+                long long qtd = IloRound(valores[x + i]);
+                if (mostrados < MAX_DETALHES && (qtd > 0 || NUM_PADROES <= MAX_DETALHES)) {
+                    cout << "Quantidade padrão "<< i+1 << " = " << qtd << endl;
+                    mostrados++;
+                }
+                tempo += qtd * d.tempo[i];
+            }
+            cout << "Latinhas = " << valores[L] << endl;
+            cout << "Tempo total de impressão = " << tempo << endl;
+            valores.end();
         }
-        cout << "Tempo total de impressão = " << tempo << endl;
-        
-        
     }
     catch (IloException& e) {
         cerr << "Erro CPLEX: " << e << endl;
     }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
     catch (...) {
         cerr << "Erro desconhecido" << endl;
     }
     env.end();
-    return 0;
-}
\ No newline at end of file
+    return result;
+}
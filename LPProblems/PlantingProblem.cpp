@@ -1,118 +1,104 @@
 #include <ilcplex/ilocplex.h>
 #include <iostream>
+#include "Problems.hpp"
+#include "ModelBuilder.hpp"
 ILOSTLBEGIN
 
-int PlantingProblem() {
+ProblemResult PlantingProblem(const ProblemOptions &opts) {
+    ProblemResult result;
     IloEnv env;
     try {
+        Timer timer;
+        // Dados
+        const PlantingData d = loadPlanting(opts);
+        result.loadTime = timer.lap();
+        const int NUM_FAZENDAS = d.numFazendas;
+        const int NUM_PLANTIOS = d.numPlantios;
+
         // Criar modelo
         IloModel model(env);
+        ModelBuilder mb(env, opts);
 
-        //Constantes
-        const int NUM_FAZENDAS = 3;
-        const int NUM_PLANTIOS = 3;
-        const int area_fazendas[NUM_FAZENDAS] = {
-            400, 650, 350
-        };
-        const int agua_fazendas[NUM_FAZENDAS] = {
-            1800, 2200, 950
-        };
-        const int area_max_plantios[NUM_PLANTIOS] = {
-            660, 880, 400
-        };
-        const int lucro_plantios[NUM_PLANTIOS] = {
-            5000, 4000, 1800
-        };
-        const double agua_por_area_plantios[NUM_PLANTIOS] = {
-            5.5, 4, 3.5
-        };
-
-        // Variáveis
-        IloArray <IloIntVarArray> x(env, NUM_FAZENDAS);
+        // Variáveis: a área de um plantio numa fazenda não passa do máximo desse plantio;
+        // x[i][j] no índice x + i * NUM_PLANTIOS + j
+        const int x = mb.addVars(NUM_FAZENDAS * NUM_PLANTIOS, 0, 0, IloNumVar::Int, [&](int k) {
+            return "x" + std::to_string(k / NUM_PLANTIOS + 1) + "_" + std::to_string(k % NUM_PLANTIOS + 1);
+        });
         for (int i = 0; i < NUM_FAZENDAS; i++) {
-            x[i] = IloIntVarArray(env, NUM_PLANTIOS, 0, area_max_plantios[i]);
             for (int j = 0; j < NUM_PLANTIOS; j++) {
-                x[i][j].setName(("x" + std::to_string(i + 1) + std::to_string(j + 1)).c_str());
+                mb.setBounds(x + i * NUM_PLANTIOS + j, 0, (IloInt)d.areaMaxPlantio[j]);
             }
         }
 
         // Função objetivo: Maximizar lucro
-        IloExpr lucro(env);
         for (int i = 0; i < NUM_FAZENDAS; i++) {
             for (int j = 0; j < NUM_PLANTIOS; j++) {
-                lucro += lucro_plantios[j] * x[i][j];
+                mb.setObjective(x + i * NUM_PLANTIOS + j, d.lucro[j]);
             }
         }
-        model.add(IloMaximize(env, lucro));
-        lucro.end();
 
         // Restrições
         // Área total plantada em cada fazenda
         for (int i = 0; i < NUM_FAZENDAS; i++) {
-            IloExpr area_total(env);
+            const int area_total = mb.addRow(-IloInfinity, d.area[i]);
             for (int j = 0; j < NUM_PLANTIOS; j++) {
-                area_total += x[i][j];
+                mb.addCoef(area_total, x + i * NUM_PLANTIOS + j, 1);
             }
-            model.add(area_total <= area_fazendas[i]);
-            area_total.end();
         }
         // Água total utilizada em cada fazenda
         for (int i = 0; i < NUM_FAZENDAS; i++) {
-            IloExpr agua_total(env);
+            const int agua_total = mb.addRow(-IloInfinity, d.agua[i]);
             for (int j = 0; j < NUM_PLANTIOS; j++) {
-                agua_total += agua_por_area_plantios[j] * x[i][j];
+                mb.addCoef(agua_total, x + i * NUM_PLANTIOS + j, d.aguaPorArea[j]);
             }
-            model.add(agua_total <= agua_fazendas[i]);
-            agua_total.end();
         }
         // Área total plantada em cada plantio
         for (int j = 0; j < NUM_PLANTIOS; j++) {
-            IloExpr area_total(env);
+            const int area_total = mb.addRow(-IloInfinity, d.areaMaxPlantio[j]);
             for (int i = 0; i < NUM_FAZENDAS; i++) {
-                area_total += x[i][j];
+                mb.addCoef(area_total, x + i * NUM_PLANTIOS + j, 1);
             }
-            model.add(area_total <= area_max_plantios[j]);
-            area_total.end();
         }
-        // Proporção igual para cada fazenda
-        IloNumExprArray proporcoes(env,NUM_FAZENDAS);
-        for (int i = 0; i < NUM_FAZENDAS; i++) {
-            IloExpr proporcao(env);
+        // Proporção igual para cada fazenda (cada fazenda igual à seguinte):
+        // sum_j x[i][j] / area[i] - sum_j x[i + 1][j] / area[i + 1] = 0
+        for (int i = 0; i + 1 < NUM_FAZENDAS; i++) {
+            const int proporcao = mb.addRow(0, 0);
             for (int j = 0; j < NUM_PLANTIOS; j++) {
-                proporcao += x[i][j];
+                mb.addCoef(proporcao, x + i * NUM_PLANTIOS + j, 1.0 / d.area[i]);
+                mb.addCoef(proporcao, x + (i + 1) * NUM_PLANTIOS + j, -1.0 / d.area[i + 1]);
             }
-            proporcoes[i] = proporcao / area_fazendas[i];
         }
-        model.add(proporcoes[0] == proporcoes[1]);
-        model.add(proporcoes[1] == proporcoes[2]);
-        for (int i = 0; i < NUM_FAZENDAS; i++) {
-            proporcoes[i].end();
-        } 
+        mb.extract(model, IloObjective::Maximize);
         // Resolver
         IloCplex cplex(model);
-        if (!cplex.solve()) {
+        result.buildTime = timer.lap();
+        if (!solveModel(cplex, opts, result)) {
             env.error() << "Falha ao resolver o modelo" << endl;
             throw(-1);
         }
         
-        // Resultados
-        cout << "Solução ótima = " << cplex.getObjValue() << endl;
-        cout << "Quantidade de cada plantio em cada fazenda:" << endl;
-        for (int i = 0; i < NUM_FAZENDAS; i++) {
-            cout << "Fazenda " << i + 1 << ": ";
-            for (int j = 0; j < NUM_PLANTIOS; j++) {
-                cout << x[i][j].getName() << " = " << cplex.getValue(x[i][j]) << " ";
+        if (!opts.quiet) {
+            // Resultados
+            cout << "Solução ótima = " << cplex.getObjValue() << endl;
+            cout << "Quantidade de cada plantio em cada fazenda:" << endl;
+            for (int i = 0; i < NUM_FAZENDAS && i < MAX_DETALHES; i++) {
+                cout << "Fazenda " << i + 1 << ": ";
+                for (int j = 0; j < NUM_PLANTIOS && j < MAX_DETALHES; j++) {
+                    cout << "x" << i + 1 << "_" << j + 1 << " = " << cplex.getValue(mb.var(x + i * NUM_PLANTIOS + j)) << " ";
+                }
+                cout << endl;
             }
-            cout << endl;
         }
-        
     }
     catch (IloException& e) {
         cerr << "Erro CPLEX: " << e << endl;
     }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
     catch (...) {
         cerr << "Erro desconhecido" << endl;
     }
     env.end();
-    return 0;
-}
\ No newline at end of file
+    return result;
+}
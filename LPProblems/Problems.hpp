@@ -1,19 +1,63 @@
 // LPProblems/RationProblem.hpp
 #ifndef PROBLEMS_HPP
 #define PROBLEMS_HPP
+#include <chrono>
+#include <cmath>
+#include <string>
+#include "Instances.hpp"
+
+// Resultado de uma execução (todos os tempos em segundos)
+struct ProblemResult {
+    std::string status = "Error";  // IloAlgorithm::Status, ou "Error" se houve exceção
+    double objective = NAN;
+    double loadTime = 0;   // Leitura ou geração da instância
+    double buildTime = 0;  // Construção do modelo e extração pelo CPLEX
+    double solveTime = 0;
+    long long nodes = 0;   // Nós de branch-and-bound (0 para LP)
+    double gap = NAN;      // Gap relativo final (somente MIP)
+};
+
+// Cronômetro: "lap" devolve os segundos desde a marca anterior
+class Timer {
+public:
+    double lap() {
+        auto now = std::chrono::steady_clock::now();
+        double seconds = std::chrono::duration<double>(now - last).count();
+        last = now;
+        return seconds;
+    }
+
+private:
+    std::chrono::steady_clock::time_point last = std::chrono::steady_clock::now();
+};
+
+class IloCplex;
+
+// Aplica as opções de resolução, resolve e preenche status, objetivo, tempo, nós e gap
+bool solveModel(IloCplex &cplex, const ProblemOptions &opts, ProblemResult &result);
+
+// Memória residente do processo em KB (Linux, /proc/self/status): a atual e o pico desde o
+// início ou desde o último resetPeakMemory(); -1 se indisponível
+long long residentMemoryKB();
+long long peakMemoryKB();
+// Zera o pico (escreve "5" em /proc/self/clear_refs); false se o sistema não permite
+bool resetPeakMemory();
+
 // Declaração de funções
-int RationProblem();
-int DietProblem();
-int PlantingProblem();
-int PaintProblem();
-int TransportProblem();
-int MaxFlowProblem();
-int ScheduleScalingProblem();
-int CoverProblem();
-int KnapsackProblem();
-int PatternProblem();
-int FacilityProblem();
-int FrequencyProblem();
-int MaximumCliqueProblem();
+ProblemResult RationProblem(const ProblemOptions &opts);
+ProblemResult DietProblem(const ProblemOptions &opts);
+ProblemResult PlantingProblem(const ProblemOptions &opts);
+ProblemResult PaintProblem(const ProblemOptions &opts);
+ProblemResult TransportProblem(const ProblemOptions &opts);
+ProblemResult MaxFlowProblem(const ProblemOptions &opts);
+ProblemResult ScheduleScalingProblem(const ProblemOptions &opts);
+ProblemResult CoverProblem(const ProblemOptions &opts);
+ProblemResult KnapsackProblem(const ProblemOptions &opts);
+ProblemResult PatternProblem(const ProblemOptions &opts);
+ProblemResult CuttingStockProblem(const ProblemOptions &opts);
+ProblemResult BinPackingProblem(const ProblemOptions &opts);
+ProblemResult FacilityProblem(const ProblemOptions &opts);
+ProblemResult FrequencyProblem(const ProblemOptions &opts);
+ProblemResult MaximumCliqueProblem(const ProblemOptions &opts);
 
 #endif
\ No newline at end of file
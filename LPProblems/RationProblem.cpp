@@ -1,56 +1,80 @@
 #include <ilcplex/ilocplex.h>
+#include <algorithm>
+#include <cmath>
+#include "Problems.hpp"
+#include "ModelBuilder.hpp"
 
 ILOSTLBEGIN
 
-int RationProblem() {
+ProblemResult RationProblem(const ProblemOptions &opts) {
+    ProblemResult result;
     IloEnv env;
     try {
-        // Criar modelo
-        IloModel model(env);
-        
-        int MAX_CARNES = 10000;
-        int MAX_CEREAIS = 30000;
-        int MAX_AMGS = MAX_CEREAIS/5;
-        int MAX_RE = MAX_CARNES/4;
-
-        // Variáveis
-        IloIntVar AMGS(env, 0.0, MAX_AMGS, "AMGS");
-        IloIntVar RE(env, 0.0, MAX_RE, "RE");
-        
+        Timer timer;
+        // Dados (no exemplo: produto 1 = AMGS, produto 2 = RE; recurso 1 = cereais, recurso 2 = carne)
         //AMGS utiliza 5kg de cereais e 1kg de carne
         //RE utiliza 2kg de cereais e 4kg de carne
         //Lucro líquido unidade da ração
             //AMGS = 20 - (5kg * 1 + 1kg * 4) = 11
             //RE = 30 - (2kg * 1 + 4kg * 4) = 12
-        
-            // Função objetivo: Maximizar lucro:
-            // AMGS*11 + RE*12
-        model.add(IloMaximize(env, AMGS * 11 + RE * 12));
-        
-        // Restrições
-            // Total de cereais: AMGS * 5 + RE * 2 <=30000
-            // Total de carne: AMGS * 1 + RE * 4 <= 10000
-        model.add(AMGS * 5 + RE * 2 <= MAX_CEREAIS);
-        model.add(AMGS * 1 + RE * 4 <= MAX_CARNES);
-        
+        const RationData d = loadRation(opts);
+        result.loadTime = timer.lap();
+        const int P = d.numProdutos;
+        const int R = d.numRecursos;
+
+        // Criar modelo
+        IloModel model(env);
+        ModelBuilder mb(env, opts);
+
+        // Variáveis: limite superior = produção máxima permitida pelo recurso mais escasso
+        const int x = mb.addVars(P, 0, 0, IloNumVar::Int, [](int p) { return "x" + std::to_string(p + 1); });
+        for (int p = 0; p < P; p++) {
+            double limite = IloIntMax;
+            for (int r = 0; r < R; r++) {
+                if (d.uso[r * P + p] > 0) limite = min(limite, floor(d.disponivel[r] / d.uso[r * P + p]));
+            }
+            mb.setBounds(x + p, 0, limite);
+        }
+
+        // Função objetivo: Maximizar lucro
+        for (int p = 0; p < P; p++) {
+            mb.setObjective(x + p, d.lucro[p]);
+        }
+
+        // Restrições: consumo de cada recurso
+        for (int r = 0; r < R; r++) {
+            const int consumo = mb.addRow(-IloInfinity, d.disponivel[r]);
+            for (int p = 0; p < P; p++) {
+                if (d.uso[r * P + p] != 0) mb.addCoef(consumo, x + p, d.uso[r * P + p]);
+            }
+        }
+        mb.extract(model, IloObjective::Maximize);
+
         // Resolver
         IloCplex cplex(model);
-        if (!cplex.solve()) {
+        result.buildTime = timer.lap();
+        if (!solveModel(cplex, opts, result)) {
             env.error() << "Falha ao resolver o modelo" << endl;
             throw(-1);
         }
-        
-        // Resultados
-        cout << "Solução ótima = " << cplex.getObjValue() << endl;
-        cout << "AMGS = " << cplex.getValue(AMGS) << endl;
-        cout << "RE = " << cplex.getValue(RE) << endl;
+
+        if (!opts.quiet) {
+            // Resultados
+            cout << "Solução ótima = " << cplex.getObjValue() << endl;
+            for (int p = 0; p < P && p < MAX_DETALHES; p++) {
+                cout << "x" << p + 1 << " = " << cplex.getValue(mb.var(x + p)) << endl;
+            }
+        }
     }
     catch (IloException& e) {
         cerr << "Erro CPLEX: " << e << endl;
     }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
     catch (...) {
         cerr << "Erro desconhecido" << endl;
     }
     env.end();
-    return 0;
-}
\ No newline at end of file
+    return result;
+}
@@ -1,19 +1,17 @@
 #include <ilcplex/ilocplex.h>
+#include <algorithm>
+#include "Problems.hpp"
+#include "ModelBuilder.hpp"
 
 ILOSTLBEGIN
 
 
-int ScheduleScalingProblem() {
+ProblemResult ScheduleScalingProblem(const ProblemOptions &opts) {
+    ProblemResult result;
     IloEnv env;
     try {
-        // Criar modelo
-        IloModel model(env);
-
-        // Constantes de exemplo
-        const int WEEK = 7;
-        const int DEMANDA[WEEK] = {2, 3, 4, 2, 3, 1, 1};
-        const int WORK = 5;
-
+        Timer timer;
+        // Dados (no exemplo: semana de 7 dias, turnos de 5 dias)
         // 0 --> Domingo 
         // 1 --> Segunda
         // 2 --> Terça
@@ -21,54 +19,61 @@ int ScheduleScalingProblem() {
         // 4 --> Quinta
         // 5 --> Sexta
         // 6 --> Sábado
-        
-        // Variáveis de decisão
-        IloIntVarArray x(env, WEEK, 0, 1000); // Limite superior arbitrário
-        for (int i = 0; i < WEEK; i++) {
-            x[i].setName(("x" + std::to_string(i)).c_str());
-        }
+        const ScheduleData d = loadSchedule(opts);
+        result.loadTime = timer.lap();
+        const int WEEK = d.dias;
+        const int WORK = d.turno;
+        const int MAX_DEMANDA = *max_element(d.demanda.begin(), d.demanda.end());
+
+        // Criar modelo
+        IloModel model(env);
+        ModelBuilder mb(env, opts);
+
+        // Variáveis de decisão: ninguém precisa começar num dia mais que a maior demanda
+        const int x = mb.addVars(WEEK, 0, max(0, MAX_DEMANDA), IloNumVar::Int,
+                                 [](int i) { return "x" + std::to_string(i); });
         // Função objetivo: Minimizar a demanda
-        IloExpr obj(env);
         for (int i = 0; i < WEEK; i++) {
-            obj += x[i];
+            mb.setObjective(x + i, 1);
         }
-        model.add(IloMinimize(env, obj));
-        obj.end();
         // Restrições
         // Restrição de dias de trabalho (D[i] <= Xi-4 + Xi-3 + Xi-2 + Xi-1 + Xi) (Assumindo um array circular)
         for (int i = 0; i < WEEK; i++) {
             int cont = WORK -1;
-            IloExpr expr(env);
+            const int linha = mb.addRow(d.demanda[i], IloInfinity);
             while (cont >= 0){
                 int indice = ((i - cont) + WEEK) % WEEK;
-                expr += x[indice];
+                mb.addCoef(linha, x + indice, 1);
                 cont--;
             }
-            model.add(expr >= DEMANDA[i]);
-            expr.end();
         }
+        mb.extract(model, IloObjective::Minimize);
 
         // Resolver
         IloCplex cplex(model);
-        if (!cplex.solve()) {
+        result.buildTime = timer.lap();
+        if (!solveModel(cplex, opts, result)) {
             env.error() << "Falha ao resolver o modelo" << endl;
             throw(-1);
         }
         
-        // Resultados
-        cout << "Solução ótima = " << cplex.getObjValue() << endl;
-        for (int i = 0; i < WEEK; i++) {
-            cout << " DIA "<< i + 1 << " x[" << i << "] = " << cplex.getValue(x[i]) << endl;
+        if (!opts.quiet) {
+            // Resultados
+            cout << "Solução ótima = " << cplex.getObjValue() << endl;
+            for (int i = 0; i < WEEK && i < MAX_DETALHES; i++) {
+                cout << " DIA "<< i + 1 << " x[" << i << "] = " << cplex.getValue(mb.var(x + i)) << endl;
+            }
         }
-        
-        
     }
     catch (IloException& e) {
         cerr << "Erro CPLEX: " << e << endl;
     }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
     catch (...) {
         cerr << "Erro desconhecido" << endl;
     }
     env.end();
-    return 0;
-}
\ No newline at end of file
+    return result;
+}
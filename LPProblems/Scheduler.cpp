@@ -0,0 +1,36 @@
+#include "Scheduler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace std;
+
+vector<Split> splitsFor(int cores) {
+    cores = max(1, cores);
+    vector<Split> splits;
+    for (int workers = 1; workers <= cores; workers++) {
+        if (cores % workers == 0) splits.push_back({workers, cores / workers});
+    }
+    return splits;
+}
+
+double runConcurrent(size_t count, int workers, const function<void(size_t)> &run) {
+    auto inicio = chrono::steady_clock::now();
+    atomic<size_t> proxima(0);
+    auto worker = [&]() {
+        for (size_t i = proxima++; i < count; i = proxima++) {
+            run(i);
+        }
+    };
+    workers = (int)min<size_t>(max(1, workers), max<size_t>(1, count));
+    vector<thread> threads;
+    for (int w = 1; w < workers; w++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &t : threads) {
+        t.join();
+    }
+    return chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+}
@@ -0,0 +1,26 @@
+// LPProblems/Scheduler.hpp
+// Execução concorrente de modelos independentes.
+//
+// Cada tarefa chama uma função de problema, que cria e destrói o seu próprio IloEnv, de
+// modo que os workers não compartilham nenhum objeto do Concert. O orçamento de núcleos
+// da máquina é dividido entre "workers" resoluções simultâneas, cada uma com
+// "threadsPorModelo" threads do CPLEX (parâmetro Threads).
+#ifndef SCHEDULER_HPP
+#define SCHEDULER_HPP
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+struct Split {
+    int workers = 1;          // Modelos resolvidos ao mesmo tempo
+    int threadsPorModelo = 0; // Threads do CPLEX em cada modelo; 0 = escolha do CPLEX
+};
+
+// Divisões exatas de "cores": workers percorre os divisores de cores, threads = cores / workers
+std::vector<Split> splitsFor(int cores);
+
+// Executa run(0), ..., run(count - 1) com "workers" threads (fila de tarefas compartilhada).
+// Devolve o tempo total em segundos.
+double runConcurrent(size_t count, int workers, const std::function<void(size_t)> &run);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include <ilcplex/ilocplex.h>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include "Problems.hpp"
+
+ILOSTLBEGIN
+
+bool solveModel(IloCplex &cplex, const ProblemOptions &opts, ProblemResult &result) {
+    if (!opts.cplexLog) {
+        cplex.setOut(cplex.getEnv().getNullStream());
+        cplex.setWarning(cplex.getEnv().getNullStream());
+    }
+    if (opts.threads > 0) cplex.setParam(IloCplex::Param::Threads, opts.threads);
+    if (opts.timeLimit > 0) cplex.setParam(IloCplex::Param::TimeLimit, opts.timeLimit);
+    if (opts.gap >= 0) cplex.setParam(IloCplex::Param::MIP::Tolerances::MIPGap, opts.gap);
+
+    Timer timer;
+    bool ok = cplex.solve();
+    result.solveTime = timer.lap();
+
+    ostringstream status;
+    status << cplex.getStatus();
+    result.status = status.str();
+    if (ok) result.objective = cplex.getObjValue();
+    if (cplex.isMIP()) {
+        result.nodes = cplex.getNnodes();
+        if (ok) result.gap = cplex.getMIPRelativeGap();
+    }
+    return ok;
+}
+
+// Valor em KB do campo "nome" de /proc/self/status
+static long long statusField(const char *nome) {
+    FILE *f = fopen("/proc/self/status", "r");
+    if (!f) return -1;
+    char linha[256];
+    long long valor = -1;
+    const size_t n = strlen(nome);
+    while (fgets(linha, sizeof(linha), f)) {
+        if (strncmp(linha, nome, n) == 0) {
+            sscanf(linha + n, "%lld", &valor);
+            break;
+        }
+    }
+    fclose(f);
+    return valor;
+}
+
+long long residentMemoryKB() {
+    return statusField("VmRSS:");
+}
+
+long long peakMemoryKB() {
+    return statusField("VmHWM:");
+}
+
+bool resetPeakMemory() {
+    FILE *f = fopen("/proc/self/clear_refs", "w");
+    if (!f) return false;
+    bool ok = fputs("5", f) >= 0;
+    return fclose(f) == 0 && ok;
+}
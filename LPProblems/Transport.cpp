@@ -0,0 +1,356 @@
+#include "Transport.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+using namespace std;
+
+TransportSolver::TransportSolver(const TransportData &d)
+    : d(d), m(d.numFabricas), n(d.numDepositos), N(d.numDepositos + 1) {
+    long long ofertaTotal = 0, demandaTotal = 0, maiorCusto = 0;
+    for (int q : d.oferta) ofertaTotal += q;
+    for (int q : d.demanda) demandaTotal += q;
+    for (int c : d.custo) maiorCusto = max<long long>(maiorCusto, c);
+
+    // Big-M: os custos permitidos são >= 0 e o fluxo total é a oferta total, então uma
+    // unidade numa rota proibida custa mais que qualquer solução que só usa rotas permitidas
+    bigM = maiorCusto * ofertaTotal + 1;
+    if ((long double)bigM * max<long long>(ofertaTotal, m + N) * 4 > (long double)LLONG_MAX) {
+        throw runtime_error("custos e ofertas grandes demais para o simplex de transporte");
+    }
+
+    supply.assign(d.oferta.begin(), d.oferta.end());
+    demand.assign(d.demanda.begin(), d.demanda.end());
+    demand.push_back(ofertaTotal - demandaTotal);  // Depósito fictício (negativo: inviável)
+
+    cost.resize((size_t)m * N);
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) {
+            int c = d.custo[(size_t)i * n + j];
+            cost[(size_t)i * N + j] = c >= 0 ? c : bigM;
+        }
+        cost[(size_t)i * N + n] = 0;
+    }
+    blockSize = max<long long>(32, (long long)sqrt((double)m * N));
+}
+
+// Aproximação de Vogel: a cada passo, a linha ou coluna com a maior diferença entre os dois
+// menores custos ativos recebe o máximo possível na sua célula mais barata. Cada linha e
+// coluna é ordenada uma vez; os ponteiros só avançam, porque linhas e colunas só saem.
+// Cada passo remove exatamente uma linha ou coluna (em empates, só uma), o que dá as
+// m + N - 1 células de uma base em árvore, incluindo as degeneradas (fluxo zero).
+void TransportSolver::vogel() {
+    vector<int> rowOrder((size_t)m * N), colOrder((size_t)N * m);
+    for (int i = 0; i < m; i++) {
+        int *ordem = &rowOrder[(size_t)i * N];
+        const long long *linha = &cost[(size_t)i * N];
+        iota(ordem, ordem + N, 0);
+        sort(ordem, ordem + N, [&](int a, int b) { return linha[a] < linha[b]; });
+    }
+    for (int j = 0; j < N; j++) {
+        int *ordem = &colOrder[(size_t)j * m];
+        iota(ordem, ordem + m, 0);
+        sort(ordem, ordem + m, [&](int a, int b) { return cost[(size_t)a * N + j] < cost[(size_t)b * N + j]; });
+    }
+
+    vector<long long> rs = supply, rd = demand;
+    vector<char> rowOn(m, 1), colOn(N, 1);
+    vector<int> rp1(m, 0), rp2(m, 1), cp1(N, 0), cp2(N, 1);
+    int linhasAtivas = m;
+
+    // Os dois primeiros ativos de uma lista ordenada (-1 se não houver)
+    auto melhores = [](const int *ordem, int tam, const vector<char> &ativo, int &p1, int &p2, int &b1, int &b2) {
+        while (p1 < tam && !ativo[ordem[p1]]) p1++;
+        p2 = max(p2, p1 + 1);
+        while (p2 < tam && !ativo[ordem[p2]]) p2++;
+        b1 = p1 < tam ? ordem[p1] : -1;
+        b2 = p2 < tam ? ordem[p2] : -1;
+    };
+
+    slotCell.clear();
+    slotFlow.clear();
+    initialCost = 0;
+    for (int passo = 0; passo < m + N - 1; passo++) {
+        long long melhorPenalidade = -1, melhorCusto = 0;
+        int ei = -1, ej = -1;
+        for (int i = 0; i < m; i++) {
+            if (!rowOn[i]) continue;
+            int b1, b2;
+            melhores(&rowOrder[(size_t)i * N], N, colOn, rp1[i], rp2[i], b1, b2);
+            const long long *linha = &cost[(size_t)i * N];
+            long long penalidade = b2 >= 0 ? linha[b2] - linha[b1] : 0;
+            if (penalidade > melhorPenalidade || (penalidade == melhorPenalidade && linha[b1] < melhorCusto)) {
+                melhorPenalidade = penalidade;
+                melhorCusto = linha[b1];
+                ei = i;
+                ej = b1;
+            }
+        }
+        for (int j = 0; j < N; j++) {
+            if (!colOn[j]) continue;
+            int b1, b2;
+            melhores(&colOrder[(size_t)j * m], m, rowOn, cp1[j], cp2[j], b1, b2);
+            long long c1 = cost[(size_t)b1 * N + j];
+            long long penalidade = b2 >= 0 ? cost[(size_t)b2 * N + j] - c1 : 0;
+            if (penalidade > melhorPenalidade || (penalidade == melhorPenalidade && c1 < melhorCusto)) {
+                melhorPenalidade = penalidade;
+                melhorCusto = c1;
+                ei = b1;
+                ej = j;
+            }
+        }
+
+        long long q = min(rs[ei], rd[ej]);
+        slotCell.push_back(ei * N + ej);
+        slotFlow.push_back(q);
+        initialCost += q * cost[(size_t)ei * N + ej];
+        rs[ei] -= q;
+        rd[ej] -= q;
+        if (rs[ei] == 0 && (rd[ej] > 0 || linhasAtivas > 1)) {
+            rowOn[ei] = 0;
+            linhasAtivas--;
+        }
+        else {
+            colOn[ej] = 0;
+        }
+    }
+}
+
+void TransportSolver::buildTree() {
+    adj.assign(m + N, {});
+    for (size_t s = 0; s < slotCell.size(); s++) {
+        int i = slotCell[s] / N, j = slotCell[s] % N;
+        adj[i].push_back({m + j, (int)s});
+        adj[m + j].push_back({i, (int)s});
+    }
+    parent.assign(m + N, -1);
+    parentSlot.assign(m + N, -1);
+    depth.assign(m + N, 0);
+    pot.assign(m + N, 0);
+    fila.assign(1, 0);
+    for (size_t k = 0; k < fila.size(); k++) {
+        int x = fila[k];
+        for (auto [y, s] : adj[x]) {
+            if (y == parent[x]) continue;
+            parent[y] = x;
+            parentSlot[y] = s;
+            depth[y] = depth[x] + 1;
+            pot[y] = cost[slotCell[s]] - pot[x];
+            fila.push_back(y);
+        }
+    }
+    if ((int)fila.size() != m + N) throw logic_error("a base inicial não forma uma árvore");
+}
+
+// Pricing por blocos: percorre as células por linhas a partir do cursor e, ao fim de cada
+// bloco, devolve a de menor custo reduzido se ele for negativo. Uma volta inteira sem
+// custo reduzido negativo prova a otimalidade.
+bool TransportSolver::price(int &ei, int &ej, long long &rc) {
+    const long long total = (long long)m * N;
+    const long long *v = &pot[m];
+    long long vistos = 0, bloco = 0;
+    rc = 0;
+    int i = ci, j = cj;
+    while (vistos < total) {
+        const long long *linha = &cost[(size_t)i * N];
+        const long long ui = pot[i];
+        for (; j < N; j++) {
+            long long r = linha[j] - ui - v[j];
+            if (r < rc) {
+                rc = r;
+                ei = i;
+                ej = j;
+            }
+            vistos++;
+            if (++bloco >= blockSize) {
+                if (rc < 0) {
+                    ci = i;
+                    cj = j + 1;
+                    return true;
+                }
+                bloco = 0;
+            }
+        }
+        j = 0;
+        i = i + 1 < m ? i + 1 : 0;
+    }
+    ci = i;
+    cj = j;
+    return rc < 0;
+}
+
+// Entra a célula (ei, ej) com custo reduzido rc < 0. O ciclo é o caminho na árvore entre a
+// fábrica ei e a coluna ej: andando da coluna ej até a fábrica ei, os arcos alternam -θ e +θ.
+// Sai o arco "-" de menor fluxo; em empates, o último encontrado ao percorrer o ciclo a
+// partir do ápice no sentido da célula que entra (regra da árvore fortemente viável).
+void TransportSolver::pivot(int ei, int ej, long long rc) {
+    const int a = ei, b = m + ej;
+    int x = a, y = b;
+    while (x != y) {
+        if (depth[x] >= depth[y]) x = parent[x];
+        else y = parent[y];
+    }
+    const int apice = x;
+
+    // Lado da fábrica: "-" nos arcos de uma fábrica para o pai; lado da coluna: de uma coluna
+    long long theta = LLONG_MAX;
+    int sai = -1;
+    bool ladoColuna = false;
+    for (x = a; x != apice; x = parent[x]) {
+        if (x < m && slotFlow[parentSlot[x]] < theta) {
+            theta = slotFlow[parentSlot[x]];
+            sai = x;
+        }
+    }
+    for (x = b; x != apice; x = parent[x]) {
+        if (x >= m && slotFlow[parentSlot[x]] <= theta) {
+            theta = slotFlow[parentSlot[x]];
+            sai = x;
+            ladoColuna = true;
+        }
+    }
+    for (x = a; x != apice; x = parent[x]) slotFlow[parentSlot[x]] += x < m ? -theta : theta;
+    for (x = b; x != apice; x = parent[x]) slotFlow[parentSlot[x]] += x >= m ? -theta : theta;
+
+    // O slot do arco que sai passa a ser a célula que entra
+    const int slot = parentSlot[sai];
+    for (int k : {sai, parent[sai]}) {
+        auto &lista = adj[k];
+        auto it = find_if(lista.begin(), lista.end(), [&](const pair<int, int> &e) { return e.second == slot; });
+        *it = lista.back();
+        lista.pop_back();
+    }
+    slotCell[slot] = ei * N + ej;
+    slotFlow[slot] = theta;
+    adj[a].push_back({b, slot});
+    adj[b].push_back({a, slot});
+
+    // A subárvore separada (a que contém "sai") é pendurada pela célula que entra:
+    // reorienta pais e profundidades e desloca seus potenciais para zerar o custo reduzido
+    const int raiz = ladoColuna ? b : a;
+    const int novoPai = ladoColuna ? a : b;
+    parent[raiz] = novoPai;
+    parentSlot[raiz] = slot;
+    depth[raiz] = depth[novoPai] + 1;
+    fila.assign(1, raiz);
+    for (size_t k = 0; k < fila.size(); k++) {
+        x = fila[k];
+        pot[x] += (x >= m) == ladoColuna ? rc : -rc;
+        for (auto [z, s] : adj[x]) {
+            if (z == parent[x]) continue;
+            parent[z] = x;
+            parentSlot[z] = s;
+            depth[z] = depth[x] + 1;
+            fila.push_back(z);
+        }
+    }
+    pivots++;
+}
+
+TransportResult TransportSolver::collect() {
+    TransportResult r;
+    r.initialCost = initialCost;
+    r.pivots = pivots;
+    for (size_t s = 0; s < slotCell.size(); s++) {
+        int i = slotCell[s] / N, j = slotCell[s] % N;
+        if (slotFlow[s] == 0 || j == n) continue;
+        if (!d.permitida(i, j)) r.feasible = false;
+        r.cost += slotFlow[s] * d.custo[(size_t)i * n + j];
+        r.shipments.push_back({i, j, (int)slotFlow[s]});
+    }
+    sort(r.shipments.begin(), r.shipments.end(), [](const Shipment &p, const Shipment &q) {
+        return p.fabrica != q.fabrica ? p.fabrica < q.fabrica : p.deposito < q.deposito;
+    });
+
+    // Duais do problema original: o potencial do fictício vai para as fábricas (u <= 0)
+    const long long vf = pot[m + n];
+    r.u.resize(m);
+    r.v.resize(n);
+    for (int i = 0; i < m; i++) r.u[i] = pot[i] + vf;
+    for (int j = 0; j < n; j++) r.v[j] = pot[m + j] - vf;
+    return r;
+}
+
+TransportResult TransportSolver::solve() {
+    if (demand[n] < 0) {
+        TransportResult r;
+        r.feasible = false;  // Oferta total menor que a demanda total
+        return r;
+    }
+    pivots = 0;
+    ci = cj = 0;
+    vogel();
+    buildTree();
+    int ei = 0, ej = 0;
+    long long rc;
+    while (price(ei, ej, rc)) pivot(ei, ej, rc);
+    return collect();
+}
+
+bool checkTransport(const TransportData &d, const TransportResult &r, string &erro) {
+    const int m = d.numFabricas, n = d.numDepositos;
+    if (!r.feasible) {
+        erro = "resultado inviável não pode ser conferido";
+        return false;
+    }
+    vector<long long> enviado(m, 0), recebido(n, 0);
+    long long custo = 0;
+    for (const Shipment &s : r.shipments) {
+        if (s.fabrica < 0 || s.fabrica >= m || s.deposito < 0 || s.deposito >= n || s.quantidade <= 0) {
+            erro = "envio inválido";
+            return false;
+        }
+        if (!d.permitida(s.fabrica, s.deposito)) {
+            erro = "envio por rota não permitida";
+            return false;
+        }
+        enviado[s.fabrica] += s.quantidade;
+        recebido[s.deposito] += s.quantidade;
+        custo += (long long)s.quantidade * d.custo[(size_t)s.fabrica * n + s.deposito];
+    }
+    for (int i = 0; i < m; i++) {
+        if (enviado[i] > d.oferta[i]) {
+            erro = "oferta excedida na fábrica " + to_string(i + 1);
+            return false;
+        }
+    }
+    for (int j = 0; j < n; j++) {
+        if (recebido[j] != d.demanda[j]) {
+            erro = "demanda não atendida no depósito " + to_string(j + 1);
+            return false;
+        }
+    }
+    if (custo != r.cost) {
+        erro = "custo dos envios diferente do informado";
+        return false;
+    }
+
+    // Duais viáveis com o mesmo valor objetivo provam a otimalidade
+    if ((int)r.u.size() != m || (int)r.v.size() != n) {
+        erro = "duais ausentes";
+        return false;
+    }
+    long long dual = 0;
+    for (int i = 0; i < m; i++) {
+        if (r.u[i] > 0) {
+            erro = "dual positivo na fábrica " + to_string(i + 1);
+            return false;
+        }
+        dual += r.u[i] * d.oferta[i];
+        for (int j = 0; j < n; j++) {
+            if (d.permitida(i, j) && r.u[i] + r.v[j] > d.custo[(size_t)i * n + j]) {
+                erro = "custo reduzido negativo na rota " + to_string(i + 1) + " -> " + to_string(j + 1);
+                return false;
+            }
+        }
+    }
+    for (int j = 0; j < n; j++) dual += r.v[j] * d.demanda[j];
+    if (dual != custo) {
+        erro = "valor dual (" + to_string(dual) + ") diferente do custo";
+        return false;
+    }
+    return true;
+}
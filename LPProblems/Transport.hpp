@@ -0,0 +1,69 @@
+// LPProblems/Transport.hpp
+// Problema de transporte nativo (sem CPLEX): simplex de transporte (MODI / stepping-stone),
+// que é o simplex de redes no grafo bipartido fábricas x depósitos.
+//
+// - Um depósito fictício de custo zero recebe a sobra de oferta, deixando o problema balanceado.
+// - Rotas não permitidas entram com custo big-M; se alguma delas terminar com fluxo, a
+//   instância é inviável.
+// - Custos em uma matriz densa por linhas (inclui a coluna fictícia): o pricing percorre
+//   uma linha contígua de custos e o vetor contíguo de potenciais dos depósitos.
+// - Solução inicial pela aproximação de Vogel; pricing por blocos (~sqrt(células) por
+//   bloco, cíclico); a árvore da base guarda pai, profundidade e potenciais, e cada pivô
+//   só percorre a subárvore que muda de lado.
+#ifndef TRANSPORT_HPP
+#define TRANSPORT_HPP
+#include <string>
+#include <vector>
+#include "Instances.hpp"
+
+struct Shipment {
+    int fabrica;
+    int deposito;
+    int quantidade;
+};
+
+struct TransportResult {
+    bool feasible = true;
+    long long cost = 0;
+    long long initialCost = 0;       // Custo da solução de Vogel
+    long long pivots = 0;
+    std::vector<Shipment> shipments;  // Rotas com fluxo positivo
+    std::vector<long long> u, v;      // Duais: u[i] <= 0 e u[i] + v[j] <= custo nas rotas permitidas
+};
+
+class TransportSolver {
+public:
+    explicit TransportSolver(const TransportData &d);
+
+    TransportResult solve();
+
+private:
+    void vogel();
+    void buildTree();
+    bool price(int &ei, int &ej, long long &rc);
+    void pivot(int ei, int ej, long long rc);
+    TransportResult collect();
+
+    const TransportData &d;
+    int m, n, N;                   // Fábricas, depósitos e colunas (depósitos + fictício)
+    long long bigM = 0;
+    std::vector<long long> cost;   // m x N, por linhas; rotas proibidas com custo bigM
+    std::vector<long long> supply, demand;
+
+    // Base: m + N - 1 células, uma por "slot"; nós 0..m-1 fábricas, m..m+N-1 colunas
+    std::vector<int> slotCell;
+    std::vector<long long> slotFlow;
+    std::vector<std::vector<std::pair<int, int>>> adj;  // (vizinho, slot)
+    std::vector<int> parent, parentSlot, depth, fila;
+    std::vector<long long> pot;    // u das fábricas seguido de v das colunas
+
+    long long blockSize = 1;
+    int ci = 0, cj = 0;            // Cursor do pricing
+    long long initialCost = 0, pivots = 0;
+};
+
+// Verifica viabilidade (rotas permitidas, oferta e demanda), o custo informado e a
+// otimalidade pelos duais (viáveis e com o mesmo valor objetivo)
+bool checkTransport(const TransportData &d, const TransportResult &r, std::string &erro);
+
+#endif
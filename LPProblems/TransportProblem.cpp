@@ -1,89 +1,172 @@
 #include <ilcplex/ilocplex.h>
+#include <algorithm>
+#include <vector>
+#include <stdexcept>
+#include "Problems.hpp"
+#include "Transport.hpp"
+#include "ModelBuilder.hpp"
 
 ILOSTLBEGIN
 
-int TransportProblem() {
+// Modelo CPLEX: uma variável por rota permitida. A matriz de restrições é totalmente
+// unimodular, então o LP já tem solução ótima inteira (não precisa de variáveis inteiras).
+static bool solveCplex(IloEnv env, const TransportData &d, const ProblemOptions &opts, ProblemResult &result,
+                       vector<Shipment> &envios) {
+    Timer timer;
+    const int NUM_FABRICAS = d.numFabricas;
+    const int NUM_DEPOSITOS = d.numDepositos;
+
+    // Criar modelo
+    IloModel model(env);
+    ModelBuilder mb(env, opts);
+
+    // Variáveis: nenhuma rota leva mais que a oferta da fábrica ou a demanda do depósito
+    vector<pair<int, int>> rotas;
+    for (int i = 0; i < NUM_FABRICAS; i++) {
+        for (int j = 0; j < NUM_DEPOSITOS; j++) {
+            if (d.permitida(i, j)) rotas.push_back({i, j});
+        }
+    }
+    const int x = mb.addVars(rotas.size(), 0, 0, IloNumVar::Float, [&](int k) {
+        return "x" + std::to_string(rotas[k].first + 1) + "_" + std::to_string(rotas[k].second + 1);
+    });
+
+    // Restrições
+    // Oferta
+    const int oferta = mb.numRows();
+    for (int i = 0; i < NUM_FABRICAS; i++) {
+        mb.addRow(-IloInfinity, d.oferta[i]);
+    }
+    // Demanda
+    const int demanda = mb.numRows();
+    for (int j = 0; j < NUM_DEPOSITOS; j++) {
+        mb.addRow(d.demanda[j], d.demanda[j]);
+    }
+
+    // Limites, função objetivo e coeficientes de cada rota
+    for (size_t k = 0; k < rotas.size(); k++) {
+        auto [i, j] = rotas[k];
+        mb.setBounds(x + k, 0, min(d.oferta[i], d.demanda[j]));
+        mb.setObjective(x + k, d.custo[i * NUM_DEPOSITOS + j]);
+        mb.addCoef(oferta + i, x + k, 1);
+        mb.addCoef(demanda + j, x + k, 1);
+    }
+    mb.extract(model, IloObjective::Minimize);
+
+    // Resolver
+    IloCplex cplex(model);
+    result.buildTime = timer.lap();
+    if (!solveModel(cplex, opts, result)) {
+        return false;
+    }
+    IloNumArray valores(env);
+    cplex.getValues(valores, mb.vars());
+    envios.clear();
+    for (size_t k = 0; k < rotas.size(); k++) {
+        int qtd = IloRound(valores[x + k]);
+        if (qtd > 0) envios.push_back({rotas[k].first, rotas[k].second, qtd});
+    }
+    valores.end();
+    return true;
+}
+
+// Simplex de transporte nativo (Vogel + MODI)
+static TransportResult solveNative(const TransportData &d, ProblemResult &result) {
+    Timer timer;
+    TransportSolver solver(d);
+    result.buildTime = timer.lap();
+    TransportResult r = solver.solve();
+    result.solveTime = timer.lap();
+    result.status = r.feasible ? "Optimal" : "Infeasible";
+    if (r.feasible) result.objective = r.cost;
+    result.nodes = 0;
+    return r;
+}
+
+static void printShipments(double custo, const vector<Shipment> &envios) {
+    // Resultados: rotas usadas
+    cout << "Solução ótima = " << custo << endl;
+    for (size_t k = 0; k < envios.size() && k < (size_t)MAX_DETALHES; k++) {
+        cout << "Fábrica " << envios[k].fabrica + 1 << " -> Depósito " << envios[k].deposito + 1 << " : "
+             << envios[k].quantidade << endl;
+    }
+}
+
+// Métodos (opts.method): "cplex" (padrão), "simplex" (nativo) ou "check", que resolve pelos
+// dois, confere o certificado do nativo (envios viáveis e duais com o mesmo valor) e compara
+ProblemResult TransportProblem(const ProblemOptions &opts) {
+    ProblemResult result;
     IloEnv env;
     try {
-        // Criar modelo
-        IloModel model(env);
-        
-        //Constantes
-        const int NUM_DEPOSITOS = 3;
-        const int NUM_FABRICAS = 3;
-        const int custoFabDep[NUM_FABRICAS][NUM_DEPOSITOS] = {
-            {8, 5, 6},
-            {15, 10, 12},
-            {3, 9, 10}
-        };
-        const int OFERTA[NUM_FABRICAS] = {120, 80, 80};
-        const int DEMANDA[NUM_DEPOSITOS] = {150, 70, 60};
-
+        Timer timer;
+        // Dados
+        const TransportData d = loadTransport(opts);
+        result.loadTime = timer.lap();
 
-        // Variáveis
-        IloArray<IloIntVarArray> x(env, NUM_FABRICAS);
-        for (int i = 0; i < NUM_FABRICAS; i++) {
-            x[i] = IloIntVarArray(env, NUM_DEPOSITOS, 0, 120);
-            for (int j = 0; j < NUM_DEPOSITOS; j++) {
-                x[i][j].setName(("x" + std::to_string(i + 1) + std::to_string(j + 1)).c_str());
+        if (opts.method == "simplex") {
+            TransportResult r = solveNative(d, result);
+            if (!opts.quiet) {
+                if (r.feasible) {
+                    printShipments(r.cost, r.shipments);
+                    cout << "Vogel: custo inicial " << r.initialCost << ", " << r.pivots << " pivôs" << endl;
+                }
+                else {
+                    cout << "Problema inviável: as rotas permitidas não atendem a demanda" << endl;
+                }
             }
         }
-        
-        // Função objetivo
-        IloExpr obj(env);
-        for (int i = 0; i < NUM_FABRICAS; i++) {
-            for (int j = 0; j < NUM_DEPOSITOS; j++) {
-                obj += custoFabDep[i][j] * x[i][j];
+        else if (opts.method == "check") {
+            ProblemResult nativo;
+            TransportResult r = solveNative(d, nativo);
+            vector<Shipment> envios;
+            bool cplexOk = solveCplex(env, d, opts, result, envios);
+            string erro;
+            bool ok;
+            if (!r.feasible || !cplexOk) {
+                ok = !r.feasible && result.status == "Infeasible";
+                if (!ok) erro = "viabilidade diferente (nativo: " + nativo.status + ", CPLEX: " + result.status + ")";
             }
-        }
-        model.add(IloMinimize(env, obj));
-        obj.end();
-        
-        // Restrições
-        // Oferta
-        for (int i = 0; i < NUM_FABRICAS; i++) {
-            IloExpr expr(env);
-            for (int j = 0; j < NUM_DEPOSITOS; j++) {
-                expr += x[i][j];
+            else {
+                ok = checkTransport(d, r, erro);
+                if (ok && r.cost != IloRound(result.objective)) {
+                    ok = false;
+                    erro = "valores diferentes";
+                }
             }
-            model.add(expr <= OFERTA[i]);
-            expr.end();
-        }
-        // Demanda
-        for (int j = 0; j < NUM_DEPOSITOS; j++) {
-            IloExpr expr(env);
-            for (int i = 0; i < NUM_FABRICAS; i++) {
-                expr += x[i][j];
+            if (!ok) {
+                cerr << "Verificação do transporte falhou: " << erro << endl;
+                result.status = "Mismatch";
+            }
+            if (!opts.quiet) {
+                if (cplexOk) printShipments(result.objective, envios);
+                cout << "Simplex de transporte = " << r.cost << " (" << nativo.solveTime << " s, " << r.pivots
+                     << " pivôs), CPLEX = " << result.objective << " (" << result.solveTime
+                     << " s): " << (ok ? "ok" : erro) << endl;
             }
-            model.add(expr == DEMANDA[j]);
-            expr.end();
-        }
-        
-
-        // Resolver
-        IloCplex cplex(model);
-        if (!cplex.solve()) {
-            env.error() << "Falha ao resolver o modelo" << endl;
-            throw(-1);
         }
-        
-        // Resultados
-        cout << "Solução ótima = " << cplex.getObjValue() << endl;
-        cout << "Depósito\t1\t2\t3" << endl;
-        for (int i = 0; i < NUM_FABRICAS; i++) {
-            cout << "Fábrica "<< i << "\t";
-            for (int j = 0; j < NUM_DEPOSITOS; j++) {
-                cout << cplex.getValue(x[i][j]) << "\t";
+        else if (opts.method == "cplex") {
+            vector<Shipment> envios;
+            if (!solveCplex(env, d, opts, result, envios)) {
+                env.error() << "Falha ao resolver o modelo" << endl;
+                throw(-1);
             }
-            cout << endl;
+            if (!opts.quiet) {
+                printShipments(result.objective, envios);
+            }
+        }
+        else {
+            throw runtime_error("método desconhecido para TransportProblem: " + opts.method);
         }
     }
     catch (IloException& e) {
         cerr << "Erro CPLEX: " << e << endl;
     }
+    catch (const std::exception& e) {
+        cerr << "Erro: " << e.what() << endl;
+    }
     catch (...) {
         cerr << "Erro desconhecido" << endl;
     }
     env.end();
-    return 0;
-}
\ No newline at end of file
+    return result;
+}
@@ -0,0 +1,644 @@
+#include "VertexCover.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <queue>
+#include <utility>
+
+using namespace std;
+
+int hopcroftKarp(int numLeft, int numRight, const vector<vector<int>> &adj, vector<int> &matchLeft,
+                 vector<int> &matchRight) {
+    matchLeft.assign(numLeft, -1);
+    matchRight.assign(numRight, -1);
+    int tamanho = 0;
+    // Emparelhamento guloso inicial
+    for (int u = 0; u < numLeft; u++) {
+        for (int r : adj[u]) {
+            if (matchRight[r] < 0) {
+                matchLeft[u] = r;
+                matchRight[r] = u;
+                tamanho++;
+                break;
+            }
+        }
+    }
+
+    const int INF = numLeft + 1;
+    vector<int> dist(numLeft), proximo(numLeft), fila, pilha;
+    while (true) {
+        // BFS em camadas a partir dos livres da esquerda
+        fila.clear();
+        for (int u = 0; u < numLeft; u++) {
+            dist[u] = matchLeft[u] < 0 ? 0 : INF;
+            if (dist[u] == 0) fila.push_back(u);
+        }
+        bool achou = false;
+        for (size_t i = 0; i < fila.size(); i++) {
+            int u = fila[i];
+            for (int r : adj[u]) {
+                int w = matchRight[r];
+                if (w < 0) {
+                    achou = true;
+                }
+                else if (dist[w] == INF) {
+                    dist[w] = dist[u] + 1;
+                    fila.push_back(w);
+                }
+            }
+        }
+        if (!achou) break;
+
+        // DFS iterativa por caminhos aumentantes nas camadas
+        fill(proximo.begin(), proximo.end(), 0);
+        for (int raiz = 0; raiz < numLeft; raiz++) {
+            if (matchLeft[raiz] >= 0) continue;
+            pilha.assign(1, raiz);
+            while (!pilha.empty()) {
+                int u = pilha.back();
+                if (proximo[u] == (int)adj[u].size()) {
+                    dist[u] = INF;  // Beco sem saída nesta fase
+                    pilha.pop_back();
+                    continue;
+                }
+                int r = adj[u][proximo[u]++];
+                int w = matchRight[r];
+                if (w < 0) {
+                    // Aumenta: cada vértice da pilha fica com a aresta por onde desceu
+                    for (int x : pilha) {
+                        int rx = adj[x][proximo[x] - 1];
+                        matchLeft[x] = rx;
+                        matchRight[rx] = x;
+                    }
+                    tamanho++;
+                    break;
+                }
+                if (dist[w] == dist[u] + 1) pilha.push_back(w);
+            }
+        }
+    }
+    return tamanho;
+}
+
+VertexCoverKernel::VertexCoverKernel(const Graph &g) : n(g.n), adj(g.n) {
+    for (const Edge &e : g.edges) {
+        if (e.from == e.to) continue;
+        adj[e.from].push_back(e.to);
+        adj[e.to].push_back(e.from);
+    }
+    deg.resize(n);
+    for (int v = 0; v < n; v++) {
+        sort(adj[v].begin(), adj[v].end());
+        adj[v].erase(unique(adj[v].begin(), adj[v].end()), adj[v].end());
+        deg[v] = adj[v].size();
+    }
+    vivo.assign(n, 1);
+    estado.assign(n, -1);
+    marca.assign(n, -1);
+}
+
+void VertexCoverKernel::kill(int v) {
+    vivo[v] = 0;
+    for (int u : adj[v]) {
+        if (vivo[u] && --deg[u] <= 2) pendentes.push_back(u);
+    }
+}
+
+void VertexCoverKernel::take(int v) {
+    estado[v] = 1;
+    forcados++;
+    kill(v);
+}
+
+void VertexCoverKernel::exclude(int v) {
+    estado[v] = 0;
+    kill(v);
+}
+
+void VertexCoverKernel::compact(int v) {
+    auto &lista = adj[v];
+    lista.erase(remove_if(lista.begin(), lista.end(), [&](int u) { return !vivo[u]; }), lista.end());
+}
+
+bool VertexCoverKernel::degreeRules() {
+    bool mudou = false;
+    while (!pendentes.empty()) {
+        int v = pendentes.back();
+        pendentes.pop_back();
+        if (!vivo[v] || deg[v] > 2) continue;
+        compact(v);
+        mudou = true;
+        if (deg[v] == 0) {
+            exclude(v);
+            grau0++;
+            continue;
+        }
+        if (deg[v] == 1) {
+            take(adj[v][0]);
+            exclude(v);
+            grau1 += 2;
+            continue;
+        }
+        const int a = adj[v][0], b = adj[v][1];
+        const auto &menor = adj[a].size() < adj[b].size() ? adj[a] : adj[b];
+        const int outro = adj[a].size() < adj[b].size() ? b : a;
+        if (find(menor.begin(), menor.end(), outro) != menor.end()) {
+            // Triângulo: os vizinhos cobrem todas as arestas de v
+            take(a);
+            take(b);
+            exclude(v);
+            grau2 += 3;
+            continue;
+        }
+
+        // Dobra: v, a e b viram um vértice novo ligado a N(a) ∪ N(b) - {v}
+        const int novo = adj.size();
+        adj.emplace_back();
+        deg.push_back(0);
+        vivo.push_back(1);
+        estado.push_back(-1);
+        marca.push_back(-1);
+        vivo[v] = vivo[a] = vivo[b] = 0;
+        for (int x : {a, b}) {
+            for (int y : adj[x]) {
+                if (!vivo[y]) continue;
+                deg[y]--;
+                if (marca[y] != novo) {
+                    marca[y] = novo;
+                    adj[novo].push_back(y);
+                }
+            }
+        }
+        for (int y : adj[novo]) {
+            adj[y].push_back(novo);
+            if (++deg[y] <= 2) pendentes.push_back(y);
+        }
+        deg[novo] = adj[novo].size();
+        if (deg[novo] <= 2) pendentes.push_back(novo);
+        dobras.push_back({v, a, b, novo});
+        forcados++;
+        grau2 += 2;
+    }
+    return mudou;
+}
+
+bool VertexCoverKernel::crownRule() {
+    // Emparelhamento maximal guloso: os vértices livres formam um conjunto independente
+    const int total = adj.size();
+    vector<char> emparelhado(total, 0);
+    vector<int> livres;
+    for (int v = 0; v < total; v++) {
+        if (!vivo[v] || emparelhado[v]) continue;
+        for (int u : adj[v]) {
+            if (vivo[u] && !emparelhado[u]) {
+                emparelhado[v] = emparelhado[u] = 1;
+                break;
+            }
+        }
+        if (!emparelhado[v]) livres.push_back(v);
+    }
+    if (livres.empty()) return false;
+
+    // Emparelhamento máximo entre os livres e seus vizinhos
+    vector<int> idDireita(total, -1), direita;
+    vector<vector<int>> bipartido(livres.size());
+    for (size_t i = 0; i < livres.size(); i++) {
+        for (int u : adj[livres[i]]) {
+            if (!vivo[u]) continue;
+            if (idDireita[u] < 0) {
+                idDireita[u] = direita.size();
+                direita.push_back(u);
+            }
+            bipartido[i].push_back(idDireita[u]);
+        }
+    }
+    vector<int> matchLeft, matchRight;
+    hopcroftKarp(livres.size(), direita.size(), bipartido, matchLeft, matchRight);
+
+    // Coroa: livres não emparelhados, fechados por caminhos alternantes
+    vector<char> naCoroa(livres.size(), 0), naCabeca(direita.size(), 0);
+    vector<int> fila;
+    for (size_t i = 0; i < livres.size(); i++) {
+        if (matchLeft[i] < 0) {
+            naCoroa[i] = 1;
+            fila.push_back(i);
+        }
+    }
+    if (fila.empty()) return false;
+    for (size_t k = 0; k < fila.size(); k++) {
+        for (int r : bipartido[fila[k]]) {
+            if (naCabeca[r]) continue;
+            naCabeca[r] = 1;
+            int i = matchRight[r];  // Emparelhado, senão haveria caminho aumentante
+            if (i >= 0 && !naCoroa[i]) {
+                naCoroa[i] = 1;
+                fila.push_back(i);
+            }
+        }
+    }
+    for (size_t r = 0; r < direita.size(); r++) {
+        if (naCabeca[r]) {
+            take(direita[r]);
+            coroa++;
+        }
+    }
+    for (int i : fila) {
+        exclude(livres[i]);
+        coroa++;
+    }
+    return true;
+}
+
+bool VertexCoverKernel::lpRule() {
+    // Grafo bipartido duplo: v à esquerda ligado a u à direita para cada aresta {u, v}
+    const int total = adj.size();
+    vector<int> id(total, -1), vertices;
+    for (int v = 0; v < total; v++) {
+        if (vivo[v]) {
+            id[v] = vertices.size();
+            vertices.push_back(v);
+        }
+    }
+    const int k = vertices.size();
+    vector<vector<int>> duplo(k);
+    for (int i = 0; i < k; i++) {
+        compact(vertices[i]);
+        for (int u : adj[vertices[i]]) duplo[i].push_back(id[u]);
+    }
+    vector<int> matchLeft, matchRight;
+    lpNucleo = hopcroftKarp(k, k, duplo, matchLeft, matchRight);
+
+    // König: Z = alcançáveis por caminhos alternantes a partir dos livres da esquerda;
+    // a cobertura mínima é (esquerda - Z) ∪ (direita ∩ Z), e x[v] = (esquerda + direita) / 2
+    vector<char> zEsquerda(k, 0), zDireita(k, 0);
+    vector<int> fila;
+    for (int i = 0; i < k; i++) {
+        if (matchLeft[i] < 0) {
+            zEsquerda[i] = 1;
+            fila.push_back(i);
+        }
+    }
+    for (size_t q = 0; q < fila.size(); q++) {
+        for (int r : duplo[fila[q]]) {
+            if (zDireita[r]) continue;
+            zDireita[r] = 1;
+            int i = matchRight[r];
+            if (i >= 0 && !zEsquerda[i]) {
+                zEsquerda[i] = 1;
+                fila.push_back(i);
+            }
+        }
+    }
+    bool mudou = false;
+    for (int i = 0; i < k; i++) {
+        int valor = !zEsquerda[i] + zDireita[i];
+        if (valor == 1) continue;
+        if (valor == 2) take(vertices[i]);
+        else exclude(vertices[i]);
+        lp++;
+        mudou = true;
+    }
+    return mudou;
+}
+
+void VertexCoverKernel::reduce() {
+    for (int v = 0; v < (int)adj.size(); v++) {
+        if (vivo[v] && deg[v] <= 2) pendentes.push_back(v);
+    }
+    while (true) {
+        degreeRules();
+        if (crownRule()) continue;
+        if (lpRule()) continue;
+        break;
+    }
+
+    // Núcleo renumerado
+    idNucleo.clear();
+    vector<int> posicao(adj.size(), -1);
+    for (int v = 0; v < (int)adj.size(); v++) {
+        if (vivo[v]) {
+            posicao[v] = idNucleo.size();
+            idNucleo.push_back(v);
+        }
+    }
+    nucleo = Graph();
+    nucleo.n = idNucleo.size();
+    for (int i = 0; i < nucleo.n; i++) {
+        for (int u : adj[idNucleo[i]]) {
+            if (vivo[u] && posicao[u] > i) nucleo.edges.push_back({i, posicao[u]});
+        }
+    }
+}
+
+vector<int> VertexCoverKernel::lift(const vector<int> &kernelCover) const {
+    vector<signed char> s = estado;
+    for (int v : idNucleo) s[v] = 0;
+    for (int i : kernelCover) s[idNucleo[i]] = 1;
+    // Desdobra na ordem inversa: o vértice novo de uma dobra pode ter sido dobrado depois
+    for (auto it = dobras.rbegin(); it != dobras.rend(); ++it) {
+        bool entrou = s[it->novo] == 1;
+        s[it->v] = !entrou;
+        s[it->a] = s[it->b] = entrou;
+    }
+    vector<int> cover;
+    for (int v = 0; v < n; v++) {
+        if (s[v] == 1) cover.push_back(v);
+    }
+    return cover;
+}
+
+namespace {
+
+// Branch-and-reduce sobre o núcleo: remoções com trilha para desfazer, reduções de grau
+// 0/1/triângulo em cada nó e ramificação no vértice de maior grau
+class BranchAndReduce {
+public:
+    BranchAndReduce(const Graph &g, double timeLimit)
+        : n(g.n), adj(g.n), deg(g.n), vivo(g.n, 1), marca(g.n, 0), limite(timeLimit),
+          inicio(chrono::steady_clock::now()) {
+        for (const Edge &e : g.edges) {
+            adj[e.from].push_back(e.to);
+            adj[e.to].push_back(e.from);
+        }
+        for (int v = 0; v < n; v++) deg[v] = adj[v].size();
+        arestas = g.edges.size();
+    }
+
+    vector<int> solve(int lowerBound, bool &optimal, long long &nodes) {
+        melhor = guloso();
+        if ((int)melhor.size() > lowerBound) {
+            for (int v = 0; v < n; v++) pendentes.push_back(v);
+            branch();
+        }
+        optimal = !parar;
+        nodes = nos;
+        return melhor;
+    }
+
+private:
+    void remove(int v, bool entra) {
+        vivo[v] = 0;
+        arestas -= deg[v];
+        for (int u : adj[v]) {
+            if (vivo[u] && --deg[u] <= 2) pendentes.push_back(u);
+        }
+        trilha.push_back({v, entra});
+        if (entra) escolhidos.push_back(v);
+    }
+
+    // Desfaz em ordem inversa: os vizinhos vivos são os mesmos de quando v saiu
+    void undo(size_t ate) {
+        while (trilha.size() > ate) {
+            auto [v, entra] = trilha.back();
+            trilha.pop_back();
+            vivo[v] = 1;
+            for (int u : adj[v]) {
+                if (vivo[u]) deg[u]++;
+            }
+            arestas += deg[v];
+            if (entra) escolhidos.pop_back();
+        }
+        pendentes.clear();
+    }
+
+    void reduzir() {
+        while (!pendentes.empty()) {
+            int v = pendentes.back();
+            pendentes.pop_back();
+            if (!vivo[v] || deg[v] > 2) continue;
+            if (deg[v] == 0) {
+                remove(v, false);
+                continue;
+            }
+            int a = -1, b = -1;
+            for (int u : adj[v]) {
+                if (!vivo[u]) continue;
+                if (a < 0) a = u;
+                else b = u;
+            }
+            if (deg[v] == 1) {
+                remove(a, true);
+                remove(v, false);
+            }
+            else if (find(adj[a].begin(), adj[a].end(), b) != adj[a].end()) {
+                remove(a, true);
+                remove(b, true);
+                remove(v, false);
+            }
+        }
+    }
+
+    // Guloso: reduções e, sem elas, o vértice de maior grau entra
+    vector<int> guloso() {
+        priority_queue<pair<int, int>> heap;
+        for (int v = 0; v < n; v++) {
+            pendentes.push_back(v);
+            heap.push({deg[v], v});
+        }
+        reduzir();
+        while (arestas > 0) {
+            auto [d, v] = heap.top();
+            heap.pop();
+            if (!vivo[v]) continue;
+            if (d != deg[v]) {
+                heap.push({deg[v], v});
+                continue;
+            }
+            remove(v, true);
+            reduzir();
+        }
+        vector<int> solucao = escolhidos;
+        undo(0);
+        return solucao;
+    }
+
+    // Limite inferior: emparelhamento guloso e arestas / grau máximo
+    int limiteInferior(int grauMaximo) {
+        carimbo++;
+        int pares = 0;
+        for (int v = 0; v < n; v++) {
+            if (!vivo[v] || marca[v] == carimbo) continue;
+            for (int u : adj[v]) {
+                if (vivo[u] && marca[u] != carimbo) {
+                    marca[v] = marca[u] = carimbo;
+                    pares++;
+                    break;
+                }
+            }
+        }
+        return (int)max<long long>(pares, (arestas + grauMaximo - 1) / grauMaximo);
+    }
+
+    // Grau máximo 2 depois das reduções: só restam ciclos sem triângulo; entram os
+    // vértices de posição par de cada ciclo
+    void ciclos() {
+        vector<int> solucao = escolhidos;
+        carimbo++;
+        for (int v = 0; v < n; v++) {
+            if (!vivo[v] || marca[v] == carimbo) continue;
+            int anterior = -1, atual = v, posicao = 0;
+            while (marca[atual] != carimbo) {
+                marca[atual] = carimbo;
+                if (posicao++ % 2 == 0) solucao.push_back(atual);
+                int seguinte = -1;
+                for (int u : adj[atual]) {
+                    if (vivo[u] && u != anterior) {
+                        seguinte = u;
+                        break;
+                    }
+                }
+                anterior = atual;
+                atual = seguinte;
+            }
+            if (solucao.size() >= melhor.size()) return;
+        }
+        melhor = solucao;
+    }
+
+    void branch() {
+        if (parar) return;
+        nos++;
+        if (limite > 0 && (nos & 255) == 0 &&
+            chrono::duration<double>(chrono::steady_clock::now() - inicio).count() > limite) {
+            parar = true;
+            return;
+        }
+        const size_t ate = trilha.size();
+        reduzir();
+        if (arestas == 0) {
+            if (escolhidos.size() < melhor.size()) melhor = escolhidos;
+            undo(ate);
+            return;
+        }
+        int v = -1;
+        for (int u = 0; u < n; u++) {
+            if (vivo[u] && (v < 0 || deg[u] > deg[v])) v = u;
+        }
+        if ((int)escolhidos.size() + limiteInferior(deg[v]) >= (int)melhor.size()) {
+            undo(ate);
+            return;
+        }
+        if (deg[v] <= 2) {
+            ciclos();
+            undo(ate);
+            return;
+        }
+
+        // Ramo 1: v entra
+        const size_t antes = trilha.size();
+        remove(v, true);
+        branch();
+        undo(antes);
+        // Ramo 2: v fica fora e todos os seus vizinhos entram
+        if ((int)escolhidos.size() + deg[v] < (int)melhor.size()) {
+            for (int u : adj[v]) {
+                if (vivo[u]) remove(u, true);
+            }
+            branch();
+            undo(antes);
+        }
+        undo(ate);
+    }
+
+    int n;
+    vector<vector<int>> adj;
+    vector<int> deg;
+    vector<char> vivo;
+    vector<int> marca;
+    int carimbo = 0;
+    long long arestas = 0;
+    vector<pair<int, bool>> trilha;
+    vector<int> escolhidos, melhor, pendentes;
+    double limite;
+    chrono::steady_clock::time_point inicio;
+    long long nos = 0;
+    bool parar = false;
+};
+
+}  // namespace
+
+CoverResult solveVertexCover(const VertexCoverKernel &kernel, double timeLimit) {
+    const auto inicio = chrono::steady_clock::now();
+    const Graph &g = kernel.kernel();
+    CoverResult r;
+    r.kernelVertices = g.n;
+    r.kernelEdges = g.edges.size();
+
+    // Componentes conexas do núcleo resolvidas separadamente. No núcleo, x = 1/2 é ótimo
+    // para o LP, então cada componente com k vértices precisa de pelo menos ceil(k / 2).
+    vector<vector<int>> vizinhos(g.n);
+    for (const Edge &e : g.edges) {
+        vizinhos[e.from].push_back(e.to);
+        vizinhos[e.to].push_back(e.from);
+    }
+    vector<int> componente(g.n, -1), local(g.n);
+    vector<int> kernelCover;
+    for (int raiz = 0; raiz < g.n; raiz++) {
+        if (componente[raiz] >= 0) continue;
+        vector<int> vertices = {raiz};
+        componente[raiz] = raiz;
+        for (size_t i = 0; i < vertices.size(); i++) {
+            for (int u : vizinhos[vertices[i]]) {
+                if (componente[u] < 0) {
+                    componente[u] = raiz;
+                    vertices.push_back(u);
+                }
+            }
+        }
+        Graph sub;
+        sub.n = vertices.size();
+        for (int i = 0; i < sub.n; i++) local[vertices[i]] = i;
+        for (int v : vertices) {
+            for (int u : vizinhos[v]) {
+                if (v < u) sub.edges.push_back({local[v], local[u]});
+            }
+        }
+
+        double resta = 0;
+        if (timeLimit > 0) {
+            resta = max(1e-9, timeLimit - chrono::duration<double>(chrono::steady_clock::now() - inicio).count());
+        }
+        bool otimo;
+        long long nos;
+        BranchAndReduce solver(sub, resta);
+        for (int i : solver.solve((sub.n + 1) / 2, otimo, nos)) kernelCover.push_back(vertices[i]);
+        r.optimal = r.optimal && otimo;
+        r.nodes += nos;
+    }
+    r.cover = kernel.lift(kernelCover);
+    r.lowerBound = r.optimal ? (int)r.cover.size() : kernel.lowerBound();
+    return r;
+}
+
+CoverResult solveVertexCover(const Graph &g, double timeLimit) {
+    const auto inicio = chrono::steady_clock::now();
+    VertexCoverKernel kernel(g);
+    kernel.reduce();
+    double resta = 0;
+    if (timeLimit > 0) {
+        resta = max(1e-3, timeLimit - chrono::duration<double>(chrono::steady_clock::now() - inicio).count());
+    }
+    return solveVertexCover(kernel, resta);
+}
+
+bool checkVertexCover(const Graph &g, const vector<int> &cover, string &erro) {
+    vector<char> dentro(g.n, 0);
+    for (int v : cover) {
+        if (v < 0 || v >= g.n) {
+            erro = "vértice fora do intervalo: " + to_string(v + 1);
+            return false;
+        }
+        if (dentro[v]) {
+            erro = "vértice repetido na cobertura: " + to_string(v + 1);
+            return false;
+        }
+        dentro[v] = 1;
+    }
+    for (const Edge &e : g.edges) {
+        if (e.from != e.to && !dentro[e.from] && !dentro[e.to]) {
+            erro = "aresta " + to_string(e.from + 1) + "-" + to_string(e.to + 1) + " descoberta";
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,98 @@
+// LPProblems/VertexCover.hpp
+// Cobertura de vértices mínima nativa (sem CPLEX) para o CoverProblem.
+//
+// Núcleo (kernel): reduções aplicadas até o ponto fixo, cada uma preservando o ótimo:
+// - grau 0: o vértice fica fora da cobertura;
+// - grau 1: o vizinho entra;
+// - grau 2: se os dois vizinhos são adjacentes (triângulo), os dois entram; senão os três
+//   vértices são dobrados (folding) num vértice novo ligado aos vizinhos dos dois, e a
+//   cobertura ganha 1. Ao desdobrar: se o novo entrou, entram os dois vizinhos; senão, o
+//   vértice de grau 2;
+// - coroa (crown): emparelhamento maximal, emparelhamento máximo entre os vértices livres
+//   e seus vizinhos, e caminhos alternantes a partir dos livres não emparelhados: a cabeça
+//   H entra e a coroa I sai;
+// - LP (Nemhauser–Trotter): a relaxação linear é semi-inteira e sai de um emparelhamento
+//   máximo (Hopcroft–Karp) no grafo bipartido duplo, pelo teorema de König; vértices com
+//   valor 1 entram e com valor 0 saem.
+//
+// O núcleo restante vai para o modelo CPLEX ou para o branch-and-reduce nativo: reduções
+// de grau 0/1/triângulo em cada nó, limite inferior por emparelhamento guloso, ramificação
+// no vértice de maior grau (ele entra, ou entram todos os seus vizinhos) e ciclos resolvidos
+// diretamente quando o grau máximo é 2.
+#ifndef VERTEX_COVER_HPP
+#define VERTEX_COVER_HPP
+#include <string>
+#include <vector>
+#include "Instances.hpp"
+
+// Emparelhamento máximo bipartido (Hopcroft–Karp, DFS iterativa); devolve o tamanho
+int hopcroftKarp(int numLeft, int numRight, const std::vector<std::vector<int>> &adj, std::vector<int> &matchLeft,
+                 std::vector<int> &matchRight);
+
+class VertexCoverKernel {
+public:
+    explicit VertexCoverKernel(const Graph &g);
+
+    // Aplica as reduções até o ponto fixo e monta o núcleo
+    void reduce();
+
+    // Núcleo renumerado 0..k-1
+    const Graph &kernel() const { return nucleo; }
+
+    // Cobertura do grafo original a partir de uma cobertura do núcleo
+    std::vector<int> lift(const std::vector<int> &kernelCover) const;
+
+    // Limites inferiores: LP do núcleo, e forçados + LP do núcleo para o grafo todo
+    int kernelLowerBound() const { return (lpNucleo + 1) / 2; }
+    int lowerBound() const { return forcados + kernelLowerBound(); }
+
+    // Vértices removidos por regra
+    int grau0 = 0, grau1 = 0, grau2 = 0, coroa = 0, lp = 0;
+
+private:
+    void take(int v);
+    void exclude(int v);
+    void kill(int v);
+    void compact(int v);
+    bool degreeRules();
+    bool crownRule();
+    bool lpRule();
+
+    int n;
+    std::vector<std::vector<int>> adj;  // Pode conter vértices já removidos
+    std::vector<int> deg;               // Vizinhos vivos
+    std::vector<char> vivo;
+    std::vector<signed char> estado;    // 1: na cobertura, 0: fora, -1: indefinido
+    std::vector<int> pendentes;         // Vértices com grau <= 2 a examinar
+    std::vector<int> marca;
+
+    struct Dobra {
+        int v, a, b, novo;
+    };
+    std::vector<Dobra> dobras;
+    int forcados = 0;                   // Vértices na cobertura já decididos (inclui 1 por dobra)
+    int lpNucleo = 0;                   // Emparelhamento do grafo duplo (2 x LP) no núcleo
+
+    Graph nucleo;
+    std::vector<int> idNucleo;          // Id interno de cada vértice do núcleo
+};
+
+struct CoverResult {
+    std::vector<int> cover;  // Vértices da cobertura, em ordem crescente
+    bool optimal = true;     // false se o limite de tempo interrompeu a busca
+    int lowerBound = 0;
+    int kernelVertices = 0;
+    int kernelEdges = 0;
+    long long nodes = 0;
+};
+
+// Branch-and-reduce sobre um núcleo já reduzido (timeLimit em segundos, 0: sem limite)
+CoverResult solveVertexCover(const VertexCoverKernel &kernel, double timeLimit = 0);
+
+// Núcleo + branch-and-reduce
+CoverResult solveVertexCover(const Graph &g, double timeLimit = 0);
+
+// Verifica se toda aresta tem uma ponta na cobertura
+bool checkVertexCover(const Graph &g, const std::vector<int> &cover, std::string &erro);
+
+#endif
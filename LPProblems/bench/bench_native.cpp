@@ -0,0 +1,469 @@
+/*
+ * Benchmark dos algoritmos nativos do LPProblems (não depende do CPLEX).
+ *
+ * Para cada tamanho gera a instância pelo mesmo gerador do modo batch ("-generate") e mede
+ * a construção da estrutura e a resolução de cada algoritmo, conferindo o resultado pelo
+ * certificado do próprio problema. As mesmas instâncias podem ser resolvidas pelo modelo
+ * CPLEX com "solver.out -problem <nome> -generate <tamanho> -method cplex".
+ *
+ * - maxflow: Dinic e push-relabel (fluxo viável e corte mínimo de mesma capacidade).
+ * - transport: simplex de transporte com partida de Vogel, matriz densa tamanho x tamanho;
+ *   "-lanes p" mantém só uma fração p das rotas (envios viáveis e duais com o mesmo valor).
+ * - clique: branch-and-bound com bitsets no grafo G(tamanho, 0,5) do gerador, ou nos grafos
+ *   DIMACS passados em "-graph" (a clique encontrada é conferida aresta a aresta).
+ * - coloring: DSATUR + tabucol + clique (limite inferior) no grafo esparso do gerador do
+ *   FrequencyProblem, ou nos grafos de "-graph" (a coloração é conferida aresta a aresta).
+ * - cover: núcleo (graus 0/1/2, coroa, LP) + branch-and-reduce no grafo em lei de potência
+ *   do gerador do CoverProblem, ou nos grafos de "-graph"; "construção" é o tempo das
+ *   reduções (a cobertura é conferida aresta a aresta; o tamanho do núcleo sai no stderr).
+ * - knapsack: programação dinâmica (se couber) e minknap na mochila do gerador, com os
+ *   valores comparados; "-batch k" resolve também um lote de k mochilas do mesmo tamanho
+ *   (sementes consecutivas) com 1 thread e com todos os núcleos.
+ * - facility: fase de subproblemas do Benders do FacilityProblem (um por cliente, forma
+ *   fechada) com 1 worker e com todos os núcleos, em 10 pontos fracionários e no ponto
+ *   inteiro com ~10% dos centros abertos (custo conferido pela atribuição ao mais barato).
+ * - cutting: heurística gulosa do CuttingStockProblem (solução conferida) e 10 rodadas da
+ *   mochila de precificação com duais perturbados em torno de largura / larguraRolo (o
+ *   padrão devolvido é conferido; "valor" é o limite de material ceil(sum d_i w_i / W)).
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Instances.hpp"
+#include "Clique.hpp"
+#include "Coloring.hpp"
+#include "CuttingStock.hpp"
+#include "Facility.hpp"
+#include "Knapsack.hpp"
+#include "MaxFlow.hpp"
+#include "Transport.hpp"
+#include "VertexCover.hpp"
+
+using namespace std;
+
+struct Config {
+    vector<string> problems = {"maxflow"};
+    vector<int> sizes = {10000, 100000};
+    double lanes = 1.0;
+    vector<string> graphs;
+    double timeLimit = 0;
+    unsigned seed = 1;
+    int batch = 0;
+};
+
+static double seconds(const function<void()> &f) {
+    auto inicio = chrono::steady_clock::now();
+    f();
+    return chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+}
+
+static vector<string> split(const string &text) {
+    vector<string> out;
+    stringstream ss(text);
+    string item;
+    while (getline(ss, item, ',')) out.push_back(item);
+    return out;
+}
+
+static void printRow(const char *problem, const char *method, int size, const string &detalhe, double build,
+                     double solve, long long value, bool ok) {
+    printf("%-9s %-12s %9d %-22s %10.3f %10.3f %14lld %s\n", problem, method, size, detalhe.c_str(), build, solve,
+           value, ok ? "ok" : "FALHOU");
+    fflush(stdout);
+}
+
+// Retorna false se algum certificado falhar ou os algoritmos discordarem
+static bool benchMaxFlow(const Config &config) {
+    bool tudoOk = true;
+    for (int size : config.sizes) {
+        ProblemOptions opts;
+        opts.size = size;
+        opts.seed = config.seed;
+        FlowNetwork g = loadMaxFlow(opts);
+        string detalhe = to_string(g.arcs.size()) + " arcos";
+
+        unique_ptr<MaxFlowSolver> solver;
+        double build = seconds([&] { solver = make_unique<MaxFlowSolver>(g); });
+        long long referencia = -1;
+        for (const string method : {"dinic", "pushrelabel"}) {
+            MaxFlowResult r;
+            double solve = seconds([&] { r = method == "dinic" ? solver->dinic() : solver->pushRelabel(); });
+            string erro;
+            bool ok = checkMaxFlow(g, r, erro) && (referencia < 0 || r.value == referencia);
+            if (!ok) {
+                fprintf(stderr, "maxflow %s n=%d: %s\n", method.c_str(), size,
+                        erro.empty() ? "valores diferentes" : erro.c_str());
+            }
+            referencia = r.value;
+            tudoOk = tudoOk && ok;
+            printRow("maxflow", method.c_str(), size, detalhe, build, solve, r.value, ok);
+        }
+    }
+    return tudoOk;
+}
+
+static bool benchTransport(const Config &config) {
+    bool tudoOk = true;
+    for (int size : config.sizes) {
+        ProblemOptions opts;
+        opts.size = size;
+        opts.seed = config.seed;
+        TransportData d = loadTransport(opts);
+        if (config.lanes < 1.0) {
+            mt19937 rng(config.seed);
+            bernoulli_distribution proibida(1.0 - config.lanes);
+            for (int &c : d.custo) {
+                if (proibida(rng)) c = -1;
+            }
+        }
+        string detalhe = to_string(d.numFabricas) + "x" + to_string(d.numDepositos);
+        if (config.lanes < 1.0) detalhe += " (" + to_string((int)(config.lanes * 100)) + "% rotas)";
+
+        unique_ptr<TransportSolver> solver;
+        double build = seconds([&] { solver = make_unique<TransportSolver>(d); });
+        TransportResult r;
+        double solve = seconds([&] { r = solver->solve(); });
+        string erro;
+        bool ok = !r.feasible || checkTransport(d, r, erro);
+        if (!ok) fprintf(stderr, "transport n=%d: %s\n", size, erro.c_str());
+        tudoOk = tudoOk && ok;
+        printRow("transport", r.feasible ? "simplex" : "inviável", size, detalhe, build, solve, r.cost, ok);
+        fprintf(stderr, "transport n=%d: Vogel %lld, %lld pivôs\n", size, r.initialCost, r.pivots);
+    }
+    return tudoOk;
+}
+
+// Instâncias de grafo: arquivos DIMACS, se houver, senão os tamanhos gerados
+static vector<ProblemOptions> graphSources(const Config &config) {
+    vector<ProblemOptions> fontes;
+    for (const string &arquivo : config.graphs) {
+        ProblemOptions opts;
+        opts.instance = arquivo;
+        fontes.push_back(opts);
+    }
+    if (fontes.empty()) {
+        for (int size : config.sizes) {
+            ProblemOptions opts;
+            opts.size = size;
+            opts.seed = config.seed;
+            fontes.push_back(opts);
+        }
+    }
+    return fontes;
+}
+
+static string graphDetail(const ProblemOptions &opts, const Graph &g) {
+    string detalhe = opts.instance.empty() ? to_string(g.edges.size()) + " arestas" : opts.instance;
+    return detalhe.size() > 22 ? detalhe.substr(detalhe.size() - 22) : detalhe;
+}
+
+static bool benchClique(const Config &config) {
+    bool tudoOk = true;
+    for (const ProblemOptions &opts : graphSources(config)) {
+        Graph g = loadCliqueGraph(opts);
+        string detalhe = graphDetail(opts, g);
+
+        unique_ptr<MaxCliqueSolver> solver;
+        double build = seconds([&] { solver = make_unique<MaxCliqueSolver>(g); });
+        CliqueResult r;
+        double solve = seconds([&] { r = solver->solve(config.timeLimit); });
+        string erro;
+        bool ok = checkClique(g, r.clique, erro);
+        if (!ok) fprintf(stderr, "clique n=%d: %s\n", g.n, erro.c_str());
+        tudoOk = tudoOk && ok;
+        printRow("clique", r.optimal ? "bnb" : "bnb (tempo)", g.n, detalhe, build, solve, r.clique.size(), ok);
+        fprintf(stderr, "clique n=%d: gulosa %d, limite %d, %d removidos pelo núcleo, %lld nós\n", g.n, r.heuristic,
+                r.upperBound, r.pruned, r.nodes);
+    }
+    return tudoOk;
+}
+
+static bool benchColoring(const Config &config) {
+    bool tudoOk = true;
+    for (const ProblemOptions &opts : graphSources(config)) {
+        Graph g = loadFrequencyGraph(opts);
+        string detalhe = graphDetail(opts, g);
+
+        vector<int> inicial;
+        double build = seconds([&] { inicial = dsatur(g); });
+        ColoringResult r;
+        double solve = seconds([&] { r = colorGraph(g, config.timeLimit, config.seed); });
+        string erro;
+        bool ok = checkColoring(g, r.color, r.colors, erro);
+        if (!ok) fprintf(stderr, "coloring n=%d: %s\n", g.n, erro.c_str());
+        tudoOk = tudoOk && ok;
+        printRow("coloring", r.optimal() ? "tabucol" : "tabucol (lb)", g.n, detalhe, build, solve, r.colors, ok);
+        fprintf(stderr, "coloring n=%d: DSATUR %d cores, clique %zu, %lld iterações do tabucol\n", g.n,
+                r.dsaturColors, r.clique.size(), r.iterations);
+    }
+    return tudoOk;
+}
+
+static bool benchCover(const Config &config) {
+    bool tudoOk = true;
+    for (const ProblemOptions &opts : graphSources(config)) {
+        Graph g = loadCoverGraph(opts);
+        string detalhe = graphDetail(opts, g);
+
+        unique_ptr<VertexCoverKernel> kernel;
+        double build = seconds([&] {
+            kernel = make_unique<VertexCoverKernel>(g);
+            kernel->reduce();
+        });
+        CoverResult r;
+        double solve = seconds([&] { r = solveVertexCover(*kernel, config.timeLimit); });
+        string erro;
+        bool ok = checkVertexCover(g, r.cover, erro);
+        if (!ok) fprintf(stderr, "cover n=%d: %s\n", g.n, erro.c_str());
+        tudoOk = tudoOk && ok;
+        printRow("cover", r.optimal ? "bnr" : "bnr (tempo)", g.n, detalhe, build, solve, r.cover.size(), ok);
+        fprintf(stderr,
+                "cover n=%d: núcleo %d vértices e %d arestas (grau 0: %d, grau 1: %d, grau 2: %d, coroa: %d, LP: %d), "
+                "limite inferior %d, %lld nós\n",
+                g.n, r.kernelVertices, r.kernelEdges, kernel->grau0, kernel->grau1, kernel->grau2, kernel->coroa,
+                kernel->lp, r.lowerBound, r.nodes);
+    }
+    return tudoOk;
+}
+
+static bool benchKnapsack(const Config &config) {
+    bool tudoOk = true;
+    for (int size : config.sizes) {
+        ProblemOptions opts;
+        opts.size = size;
+        opts.seed = config.seed;
+        KnapsackData d = loadKnapsack(opts);
+        string detalhe = "capacidade " + to_string(d.capacidade);
+
+        long long referencia = -1;
+        for (const string method : {"dp", "minknap"}) {
+            if (method == "dp" && !fitsKnapsackDP(d)) continue;
+            KnapsackResult r;
+            double solve = seconds([&] {
+                r = method == "dp" ? knapsackDP(d) : knapsackMinknap(d, config.timeLimit);
+            });
+            string erro;
+            bool ok = checkKnapsack(d, r, erro) && (referencia < 0 || !r.optimal || r.value == referencia);
+            if (!ok) {
+                fprintf(stderr, "knapsack %s n=%d: %s\n", method.c_str(), size,
+                        erro.empty() ? "valores diferentes" : erro.c_str());
+            }
+            if (r.optimal) referencia = r.value;
+            tudoOk = tudoOk && ok;
+            printRow("knapsack", r.optimal ? method.c_str() : "minknap (tempo)", size, detalhe, 0, solve, r.value, ok);
+            if (method == "minknap") fprintf(stderr, "knapsack n=%d: %lld estados do minknap\n", size, r.states);
+        }
+
+        if (config.batch <= 0) continue;
+        vector<KnapsackData> lote;
+        double build = seconds([&] {
+            for (int k = 0; k < config.batch; k++) {
+                opts.seed = config.seed + k;
+                lote.push_back(loadKnapsack(opts));
+            }
+        });
+        const int nucleos = max(1u, thread::hardware_concurrency());
+        for (int workers : {1, nucleos}) {
+            vector<KnapsackResult> resultados;
+            double solve = seconds([&] { resultados = solveKnapsacks(lote, workers, config.timeLimit); });
+            bool ok = true;
+            long long soma = 0;
+            for (size_t k = 0; k < lote.size(); k++) {
+                string erro;
+                if (!checkKnapsack(lote[k], resultados[k], erro)) {
+                    fprintf(stderr, "knapsack lote %zu: %s\n", k, erro.c_str());
+                    ok = false;
+                }
+                soma += resultados[k].value;
+            }
+            tudoOk = tudoOk && ok;
+            string metodo = "lote x" + to_string(workers);
+            printRow("knapsack", metodo.c_str(), size, to_string(config.batch) + " mochilas", build, solve, soma, ok);
+            if (nucleos == 1) break;
+        }
+    }
+    return tudoOk;
+}
+
+static bool benchFacility(const Config &config) {
+    bool tudoOk = true;
+    for (int size : config.sizes) {
+        ProblemOptions opts;
+        opts.size = size;
+        opts.seed = config.seed;
+        FacilityData d = loadFacility(opts);
+        string detalhe = to_string(d.numCentros) + " x " + to_string(d.numClientes);
+
+        // Pontos do mestre: 10 fracionários (como nas relaxações) e um inteiro
+        mt19937 rng(config.seed);
+        vector<vector<double>> pontos(11, vector<double>(d.numCentros));
+        for (size_t p = 0; p < pontos.size(); p++) {
+            for (double &x : pontos[p]) {
+                double u = uniform_real_distribution<double>(0, 1)(rng);
+                x = p < 10 ? 0.2 * u : (u < 0.1 ? 1 : 0);
+            }
+            pontos[p][0] = 1;
+        }
+
+        unique_ptr<FacilityBenders> benders;
+        double build = seconds([&] { benders = make_unique<FacilityBenders>(d); });
+        const int nucleos = benders->workers();
+        double referencia = -1;
+        for (int workers : {1, nucleos}) {
+            vector<double> custos;
+            vector<BendersCut> cortes;
+            double total = 0;
+            double solve = seconds([&] {
+                for (const auto &x : pontos) total = benders->evaluate(x, custos, cortes, workers);
+            });
+            // Custo no ponto inteiro pela atribuição direta
+            const vector<double> &inteiro = pontos.back();
+            double custo;
+            string erro;
+            bool ok = checkFacility(d, inteiro, benders->assign(inteiro), custo, erro);
+            for (int i = 0; i < d.numCentros; i++) {
+                if (inteiro[i] > 0.5) custo -= d.custoInstalacao[i];
+            }
+            ok = ok && fabs(custo - total) <= 1e-6 * max(1.0, custo) && (referencia < 0 || total == referencia);
+            if (!ok) fprintf(stderr, "facility n=%d: %s\n", size, erro.empty() ? "custos diferentes" : erro.c_str());
+            referencia = total;
+            tudoOk = tudoOk && ok;
+            string metodo = "benders x" + to_string(workers);
+            printRow("facility", metodo.c_str(), size, detalhe, build, solve, llround(total), ok);
+            if (nucleos == 1) break;
+        }
+    }
+    return tudoOk;
+}
+
+static bool benchCutting(const Config &config) {
+    bool tudoOk = true;
+    for (int size : config.sizes) {
+        ProblemOptions opts;
+        opts.size = size;
+        opts.seed = config.seed;
+        CuttingStockData d = loadCuttingStock(opts);
+        string detalhe = "rolo " + to_string(d.larguraRolo);
+
+        CuttingSolution s;
+        double solve = seconds([&] { s = greedyCutting(d, d.demanda); });
+        string erro;
+        bool ok = checkCutting(d, s, erro);
+        if (!ok) fprintf(stderr, "cutting n=%d: %s\n", size, erro.c_str());
+        tudoOk = tudoOk && ok;
+        printRow("cutting", "guloso", size, detalhe, 0, solve, s.rolos, ok);
+
+        mt19937 rng(config.seed);
+        long double material = 0;
+        for (int i = 0; i < d.numItens; i++) material += (long double)d.demanda[i] * d.largura[i];
+        unique_ptr<PatternPricer> pricer;
+        double build = seconds([&] { pricer = make_unique<PatternPricer>(d); });
+        vector<double> duais(d.numItens);
+        CuttingPattern padrao;
+        ok = true;
+        solve = seconds([&] {
+            for (int rodada = 0; rodada < 10; rodada++) {
+                for (int i = 0; i < d.numItens; i++) {
+                    duais[i] = (double)d.largura[i] / d.larguraRolo * uniform_real_distribution<double>(0.9, 1.1)(rng);
+                }
+                double valor = pricer->price(duais, padrao);
+                double soma = 0;
+                long long usado = 0;
+                for (size_t k = 0; k < padrao.itens.size(); k++) {
+                    soma += duais[padrao.itens[k]] * padrao.qtd[k];
+                    usado += d.largura[padrao.itens[k]] * padrao.qtd[k];
+                }
+                ok = ok && usado <= d.larguraRolo && fabs(soma - valor) <= 1e-9 * max(1.0, valor);
+            }
+        });
+        if (!ok) fprintf(stderr, "cutting n=%d: padrão da mochila inválido\n", size);
+        tudoOk = tudoOk && ok;
+        printRow("cutting", "mochila x10", size, detalhe, build, solve, (long long)ceil(material / d.larguraRolo), ok);
+    }
+    return tudoOk;
+}
+
+static void printUsage(const char *prog) {
+    fprintf(stderr,
+            "Uso: %s [-problem maxflow,transport,clique,coloring,cover,knapsack,facility,cutting] [-n 10000,100000] [-seed <semente>] [-lanes <fração>]\n"
+            "         [-graph <arquivo DIMACS>]... [-time <segundos>] [-batch <mochilas>]\n"
+            "  Tempos em segundos; a coluna \"valor\" é o ótimo encontrado.\n",
+            prog);
+}
+
+int main(int argc, char **argv) {
+    Config config;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-problem") == 0 && i + 1 < argc) {
+            config.problems = split(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            config.sizes.clear();
+            for (const string &s : split(argv[++i])) config.sizes.push_back(stoi(s));
+        }
+        else if (strcmp(argv[i], "-seed") == 0 && i + 1 < argc) {
+            config.seed = stoul(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-lanes") == 0 && i + 1 < argc) {
+            config.lanes = stod(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-graph") == 0 && i + 1 < argc) {
+            config.graphs.push_back(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-time") == 0 && i + 1 < argc) {
+            config.timeLimit = stod(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-batch") == 0 && i + 1 < argc) {
+            config.batch = stoi(argv[++i]);
+        }
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    printf("%-9s %-12s %9s %-22s %10s %10s %14s %s\n", "problema", "método", "tamanho", "instância", "constr.",
+           "resolução", "valor", "cert.");
+    bool ok = true;
+    for (const string &problem : config.problems) {
+        if (problem == "maxflow") {
+            ok = benchMaxFlow(config) && ok;
+        }
+        else if (problem == "transport") {
+            ok = benchTransport(config) && ok;
+        }
+        else if (problem == "clique") {
+            ok = benchClique(config) && ok;
+        }
+        else if (problem == "coloring") {
+            ok = benchColoring(config) && ok;
+        }
+        else if (problem == "cover") {
+            ok = benchCover(config) && ok;
+        }
+        else if (problem == "knapsack") {
+            ok = benchKnapsack(config) && ok;
+        }
+        else if (problem == "facility") {
+            ok = benchFacility(config) && ok;
+        }
+        else if (problem == "cutting") {
+            ok = benchCutting(config) && ok;
+        }
+        else {
+            fprintf(stderr, "Problema sem algoritmo nativo: %s\n", problem.c_str());
+            return 1;
+        }
+    }
+    return ok ? 0 : 1;
+}
@@ -1,39 +1,25 @@
 #include <ilcplex/ilocplex.h>
 #include "Problems.hpp"
+#include "Scheduler.hpp"
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <vector>
 #include <string>
 #include <functional>
+#include <sstream>
+#include <limits>
+#include <mutex>
+#include <thread>
 using namespace std;
 struct Problem {
     string name;
-    function<void(void)> func;
+    function<ProblemResult(const ProblemOptions&)> func;
 };
-int main() {
-    const vector<Problem> PROBLEMS = {
-        {"RationProblem", RationProblem},
-        {"DietProblem", DietProblem},
-        {"PlantingProblem", PlantingProblem},
-        {"PaintProblem", PaintProblem},
-        {"TransportProblem", TransportProblem},
-        {"MaxFlowProblem", MaxFlowProblem},
-        {"ScheduleScalingProblem", ScheduleScalingProblem},
-        {"CoverProblem", CoverProblem},
-        {"KnapsackProblem", KnapsackProblem},
-        {"PatternProblem", PatternProblem},
-        {"FacilityProblem", FacilityProblem},
-        {"FrequencyProblem", FrequencyProblem},
-        {"MaximumCliqueProblem", MaximumCliqueProblem},
-    };
+
+// Modo interativo: menu com a lista de problemas
+void runMenu(const vector<Problem> &PROBLEMS) {
     const int NUM_PROBLEMS = PROBLEMS.size();
-    // const vector<string> PROBLEMS= {
-    //     "RationProblem",
-    //     "DietProblem",
-    //     "PlantingProblem",
-    //     "PaintProblem",
-    //     "TransportProblem",
-    // };
-    // vector<function<void(void)>> functions = {RationProblem, DietProblem, PlantingProblem, PaintProblem, TransportProblem};
     while (true) {
         int problemChoice;
         cout << "Escolha o problema para executar:\n";
@@ -42,7 +28,9 @@ int main() {
         }
         cout << NUM_PROBLEMS + 1 << ". Sair\n";
         cout << "Digite o número do problema: ";
-        cin >> problemChoice;
+        if (!(cin >> problemChoice)) {
+            break;
+        }
 
         if (problemChoice < 1 || problemChoice > NUM_PROBLEMS + 1) {
             cout << "Opção inválida. Tente novamente.\n";
@@ -54,8 +42,275 @@ int main() {
         }
 
         else {
+            // Instância: arquivo, gerador aleatório ou o exemplo embutido
+            ProblemOptions opts;
+            string linha;
+            cout << "Instância (arquivo, \"gerar <tamanho> [semente]\" ou Enter para o exemplo): ";
+            cin.ignore(numeric_limits<streamsize>::max(), '\n');
+            getline(cin, linha);
+            istringstream campos(linha);
+            string primeiro;
+            campos >> primeiro;
+            if (primeiro == "gerar") {
+                campos >> opts.size >> opts.seed;
+            }
+            else if (!primeiro.empty()) {
+                opts.instance = primeiro;
+            }
             cout << "Executando " << PROBLEMS[problemChoice - 1].name << "...\n";
-            PROBLEMS[problemChoice-1].func();
+            ProblemResult result = PROBLEMS[problemChoice-1].func(opts);
+            cout << "Status: " << result.status << " | leitura " << result.loadTime << " s, construção "
+                 << result.buildTime << " s, resolução " << result.solveTime << " s\n";
+        }
+    }
+}
+
+// Modo batch: uma linha CSV ou JSON por execução, na saída padrão
+
+void printUsage(const char *prog) {
+    cerr << "Uso: " << prog << "    (menu interativo)\n"
+         << "     " << prog << " -problem <nome|all> [-problem ...] [-instance <arquivo>]... [-generate <tamanho>]...\n"
+         << "         [-seed <semente>] [-repeat <n>] [-threads <n>] [-time <segundos>] [-gap <gap>]\n"
+         << "         [-method <método>] [-jobs <n>] [-cores <n>] [-sweep] [-format csv|json] [-lean] [-v] [-log]\n"
+         << "  Sem -instance nem -generate, usa o exemplo embutido de cada problema.\n"
+         << "  -repeat n: n execuções por instância (sementes seed, seed+1, ... nas geradas).\n"
+         << "  -jobs n: n modelos resolvidos ao mesmo tempo, cada um com cores/n threads do CPLEX\n"
+         << "  (ou -threads); -cores: orçamento de núcleos (padrão: todos); -sweep: repete o lote\n"
+         << "  para cada divisão workers x threads do orçamento e informa modelos/s de cada uma.\n"
+         << "  -method: cplex (padrão) ou um algoritmo nativo; check resolve pelos dois e compara.\n"
+         << "  MaxFlow: dinic, pushrelabel; Transport: simplex; MaximumClique: bnb;\n"
+         << "  Frequency: dsatur, tabucol; Cover: bnr; Knapsack: dp, minknap;\n"
+         << "  Facility: lazy (ligações por callback sobre o modelo agregado), benders (multi-corte),\n"
+         << "  benders-agg (corte agregado); workers do subproblema: -threads.\n"
+         << "  CuttingStock: cplex (geração de colunas + MIP nas colunas), round (arredondamento).\n"
+         << "  BinPacking: mipstart (ILS antes do MIP), inject (ILS durante o branch-and-bound).\n"
+         << "  -lean: monta os modelos sem nomes de variáveis (construção mais rápida).\n"
+         << "  -v: imprime também a solução; -log: mostra o log do CPLEX.\n";
+}
+
+string csvNumber(double value) {
+    if (std::isnan(value)) return "";
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.10g", value);
+    return buf;
+}
+
+string jsonNumber(double value) {
+    return std::isnan(value) ? "null" : csvNumber(value);
+}
+
+string jsonString(const string &text) {
+    string out = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out + "\"";
+}
+
+string csvField(const string &text) {
+    if (text.find_first_of(",\"\n") == string::npos) return text;
+    string out = "\"";
+    for (char c : text) {
+        if (c == '"') out += '"';
+        out += c;
+    }
+    return out + "\"";
+}
+
+string formatRecord(const string &format, const string &problem, const ProblemOptions &opts,
+                    const ProblemResult &r, int workers) {
+    string instance = opts.size > 0 ? "gerada" : opts.instance.empty() ? "exemplo" : opts.instance;
+    ostringstream out;
+    if (format == "json") {
+        out << "{\"problem\":" << jsonString(problem) << ",\"method\":" << jsonString(opts.method) << ",\"instance\":" << jsonString(instance)
+             << ",\"size\":" << opts.size << ",\"seed\":" << opts.seed << ",\"status\":" << jsonString(r.status)
+             << ",\"objective\":" << jsonNumber(r.objective) << ",\"load_time\":" << jsonNumber(r.loadTime)
+             << ",\"build_time\":" << jsonNumber(r.buildTime) << ",\"solve_time\":" << jsonNumber(r.solveTime)
+             << ",\"nodes\":" << r.nodes << ",\"gap\":" << jsonNumber(r.gap) << ",\"workers\":" << workers
+             << ",\"threads\":" << opts.threads << "}\n";
+    }
+    else {
+        out << problem << "," << opts.method << "," << csvField(instance) << "," << opts.size << "," << opts.seed << "," << r.status << ","
+             << csvNumber(r.objective) << "," << csvNumber(r.loadTime) << "," << csvNumber(r.buildTime) << ","
+             << csvNumber(r.solveTime) << "," << r.nodes << "," << csvNumber(r.gap) << "," << workers << ","
+             << opts.threads << "\n";
+    }
+    return out.str();
+}
+
+int runBatch(int argc, char **argv, const vector<Problem> &PROBLEMS) {
+    vector<const Problem*> selected;
+    vector<string> instances;
+    vector<int> sizes;
+    ProblemOptions base;
+    base.quiet = true;
+    base.cplexLog = false;
+    int repeat = 1;
+    string format = "csv";
+    int jobs = 0, cores = 0;
+    bool sweep = false;
+
+    auto select = [&](const string &name) {
+        bool found = false;
+        for (const auto &p : PROBLEMS) {
+            if (name == "all" || p.name == name || p.name == name + "Problem") {
+                selected.push_back(&p);
+                found = true;
+            }
+        }
+        return found;
+    };
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-problem") == 0 && i + 1 < argc) {
+            if (!select(argv[++i])) {
+                cerr << "Problema desconhecido: " << argv[i] << "\n";
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "-instance") == 0 && i + 1 < argc) {
+            instances.push_back(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-generate") == 0 && i + 1 < argc) {
+            sizes.push_back(stoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "-seed") == 0 && i + 1 < argc) {
+            base.seed = stoul(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-repeat") == 0 && i + 1 < argc) {
+            repeat = max(1, stoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "-threads") == 0 && i + 1 < argc) {
+            base.threads = stoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-time") == 0 && i + 1 < argc) {
+            base.timeLimit = stod(argv[++i]);
         }
+        else if (strcmp(argv[i], "-gap") == 0 && i + 1 < argc) {
+            base.gap = stod(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-method") == 0 && i + 1 < argc) {
+            base.method = argv[++i];
+        }
+        else if (strcmp(argv[i], "-jobs") == 0 && i + 1 < argc) {
+            jobs = max(1, stoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "-cores") == 0 && i + 1 < argc) {
+            cores = max(1, stoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "-sweep") == 0) {
+            sweep = true;
+        }
+        else if (strcmp(argv[i], "-format") == 0 && i + 1 < argc) {
+            format = argv[++i];
+            if (format != "csv" && format != "json") {
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "-lean") == 0) {
+            base.lean = true;
+        }
+        else if (strcmp(argv[i], "-v") == 0) {
+            base.quiet = false;
+        }
+        else if (strcmp(argv[i], "-log") == 0) {
+            base.cplexLog = true;
+        }
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (selected.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // Fontes de instância: arquivos, tamanhos gerados ou o exemplo embutido
+    vector<ProblemOptions> sources;
+    for (const auto &file : instances) {
+        ProblemOptions opts = base;
+        opts.instance = file;
+        sources.push_back(opts);
+    }
+    for (int size : sizes) {
+        ProblemOptions opts = base;
+        opts.size = size;
+        sources.push_back(opts);
+    }
+    if (sources.empty()) sources.push_back(base);
+
+    // Lote: todas as combinações problema x instância x repetição
+    vector<pair<const Problem*, ProblemOptions>> batch;
+    for (const Problem *problem : selected) {
+        for (const auto &source : sources) {
+            for (int r = 0; r < repeat; r++) {
+                ProblemOptions opts = source;
+                if (opts.size > 0) opts.seed = base.seed + r;
+                batch.push_back({problem, opts});
+            }
+        }
+    }
+
+    // Divisões do orçamento de núcleos entre modelos simultâneos e threads do CPLEX
+    const bool coresGiven = cores > 0;
+    if (!coresGiven) cores = max(1u, thread::hardware_concurrency());
+    vector<Split> splits;
+    if (sweep) {
+        splits = splitsFor(cores);
+    }
+    else if (jobs > 0) {
+        splits.push_back({jobs, base.threads > 0 ? base.threads : max(1, cores / jobs)});
+    }
+    else {
+        splits.push_back({1, base.threads > 0 ? base.threads : coresGiven ? cores : 0});
+    }
+
+    if (format == "csv") {
+        cout << "problem,method,instance,size,seed,status,objective,load_time,build_time,solve_time,nodes,gap,workers,threads"
+             << endl;
+    }
+    int failures = 0;
+    mutex saida;
+    for (const Split &split : splits) {
+        double seconds = runConcurrent(batch.size(), split.workers, [&](size_t k) {
+            ProblemOptions opts = batch[k].second;
+            opts.threads = split.threadsPorModelo;
+            ProblemResult result = batch[k].first->func(opts);
+            string record = formatRecord(format, batch[k].first->name, opts, result, split.workers);
+            lock_guard<mutex> lock(saida);
+            cout << record << flush;
+            if (result.status == "Error") failures++;
+        });
+        cerr << "Divisão " << split.workers << " x " << split.threadsPorModelo << " threads: " << batch.size()
+             << " modelos em " << seconds << " s (" << batch.size() / max(seconds, 1e-9) << " modelos/s)\n";
+    }
+    return failures > 0 ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+    const vector<Problem> PROBLEMS = {
+        {"RationProblem", RationProblem},
+        {"DietProblem", DietProblem},
+        {"PlantingProblem", PlantingProblem},
+        {"PaintProblem", PaintProblem},
+        {"TransportProblem", TransportProblem},
+        {"MaxFlowProblem", MaxFlowProblem},
+        {"ScheduleScalingProblem", ScheduleScalingProblem},
+        {"CoverProblem", CoverProblem},
+        {"KnapsackProblem", KnapsackProblem},
+        {"PatternProblem", PatternProblem},
+        {"CuttingStockProblem", CuttingStockProblem},
+        {"BinPackingProblem", BinPackingProblem},
+        {"FacilityProblem", FacilityProblem},
+        {"FrequencyProblem", FrequencyProblem},
+        {"MaximumCliqueProblem", MaximumCliqueProblem},
+    };
+    if (argc > 1) {
+        return runBatch(argc, argv, PROBLEMS);
     }
-}
\ No newline at end of file
+    runMenu(PROBLEMS);
+    return 0;
+}